@@ -30,8 +30,21 @@ This License shall be included in all methodal textual files.
 
 // ----- INCLUDE FILES
 #include			MCU_FILE
+#ifdef SWDT_USE_SML
 #include			"SML.hpp"
+#endif // SWDT_USE_SML
 #include			<stdint.h>
+#include			<type_traits>
+#include			<utility>
+
+#if defined(SWDT_RTOS_FREERTOS)
+#include			"FreeRTOS.h"
+#include			"task.h"
+#elif defined(SWDT_RTOS_ZEPHYR)
+#include			<zephyr/kernel.h>
+#elif defined(SWDT_RTOS_THREADX)
+#include			"tx_api.h"
+#endif // SWDT_RTOS_FREERTOS
 
 
 /** \addtogroup SWDT
@@ -46,10 +59,214 @@ This License shall be included in all methodal textual files.
 #define SWDT_TIMEOUT			100 /**< @brief Driver operation timeout in ms. User can redefine it during build. */
 #endif // SWDT_TIMEOUT
 
+#ifndef SWDT_GET_TICK
+#define SWDT_GET_TICK()			HAL_GetTick() /**< @brief Millisecond tick source used for driver operation timeout. User can redefine it during build. */
+extern "C" uint32_t HAL_GetTick(void);
+#endif // SWDT_GET_TICK
+
+/**
+ * @brief Define WWDG interrupt handler that calls \p hook on WWDG early wakeup interrupt.
+ * 
+ * @param hook Function of type <tt>void hook(void)</tt>. Bound at compile time and inlined into \c WWDG_IRQHandler.
+ */
+#define SWDT_WWDG_EWI_HANDLER(hook) \
+	extern "C" void WWDG_IRQHandler(void) \
+	{ \
+		::SWDT::WWDGDriver::handleEWI<hook>(); \
+	}
+
+#ifndef SWDT_STATS
+#define SWDT_STATS				0 /**< @brief Default state of feed statistics. User can redefine it during build. */
+#endif // SWDT_STATS
+
+#ifndef SWDT_DEBUG_FREEZE
+#define SWDT_DEBUG_FREEZE		0 /**< @brief Freeze watchdogs while core is halted by debugger in \ref SWDT::Debug::init. Set to \c 1 for development builds. */
+#endif // SWDT_DEBUG_FREEZE
+
+#ifndef SWDT_PROFILE
+#define SWDT_PROFILE			::SWDT::Profiles::Full /**< @brief Default IWDG feature profile. User can redefine it during build, for example to \c ::SWDT::Profiles::Minimal. */
+#endif // SWDT_PROFILE
+
+#define SWDT_NOINIT				__attribute__((section(".noinit"))) /**< @brief Place variable in RAM section that is not initialized at startup. */
+
+/**
+ * @brief Register supervisor client at link time.
+ * 
+ * Client descriptor is placed in \c swdt_clients linker section, so no code runs and no memory is allocated for registration. Use \ref SWDT::Supervisor::registerClients or \ref SWDT::DeadlineSupervisor::registerClients to register all clients at startup.
+ * Section bounds are generated by GNU linker. If section is discarded with \c --gc-sections, add <tt>KEEP(*(swdt_clients))</tt> to linker script.
+ * 
+ * @param name Client name. Must be valid C identifier.
+ * @param id Supervisor channel ID.
+ * @param period Expected maximum check-in period in ms. Used as channel deadline by \ref SWDT::DeadlineSupervisor. \c 0 keeps deadline from supervisor template.
+ */
+#define SWDT_CLIENT(name, id, period) \
+	__attribute__((used, section("swdt_clients"))) static const ::SWDT::Client_t swdtClient_##name = { #name, (id), (period) }
+
+#if defined(SWDT_RTOS_FREERTOS)
+/**
+ * @brief Define FreeRTOS idle and tick hooks that drive \p adapter.
+ * 
+ * Requires \c configUSE_IDLE_HOOK and \c configUSE_TICK_HOOK set to \c 1.
+ * 
+ * @param adapter Global \ref SWDT::RTOSFeed object.
+ */
+#define SWDT_FREERTOS_HOOKS(adapter) \
+	extern "C" void vApplicationIdleHook(void) \
+	{ \
+		(adapter).idle(); \
+	} \
+	extern "C" void vApplicationTickHook(void) \
+	{ \
+		(adapter).tick(); \
+	}
+#elif defined(SWDT_RTOS_ZEPHYR)
+/**
+ * @brief Define lowest priority Zephyr thread that drives \p adapter.
+ * 
+ * @param adapter Global \ref SWDT::RTOSFeed object.
+ * @param stackSize Thread stack size in bytes.
+ */
+#define SWDT_ZEPHYR_THREAD(adapter, stackSize) \
+	static void swdtThread(void*, void*, void*) \
+	{ \
+		(adapter).run(); \
+	} \
+	K_THREAD_DEFINE(swdt_thread, stackSize, swdtThread, NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0)
+#endif // SWDT_RTOS_FREERTOS
+
 
 // ----- NAMESPACES
 namespace SWDT
 {
+	// ENUMS
+	/**
+	 * @brief Driver operation status.
+	 * 
+	 */
+	enum class Status_t : uint8_t {
+		Done = 0, /**< @brief Operation is finished. */
+		Busy, /**< @brief Operation is in progress. */
+		Timeout /**< @brief Operation did not finish within \ref SWDT_TIMEOUT. */
+	};
+
+	// STRUCTS
+	/**
+	 * @brief Achieved watchdog timing.
+	 * 
+	 */
+	struct Timing_t
+	{
+		uint32_t timeout; /**< @brief Achieved timeout in us. */
+		uint32_t resolution; /**< @brief Timeout step of selected prescaler in us. */
+		bool clamped; /**< @brief Required timeout was out of supported range and was limited. */
+		Status_t status = Status_t::Done; /**< @brief Register access status. Timing values are \c 0 if register update did not finish. */
+	};
+
+	// CLASS FOR TIMESTAMPS
+	/**
+	 * @brief Cheap timestamp source.
+	 * 
+	 * Uses DWT cycle counter on cores that have it and \ref SWDT_GET_TICK on other cores.
+	 */
+	class Clock
+	{
+		public:
+		/**
+		 * @brief Enable timestamp source.
+		 * 
+		 * Reciprocal of timestamp frequency used by \ref fromUs is calculated here. Call again after core clock change.
+		 * 
+		 * @return No return value.
+		 */
+		static void init(void)
+		{
+#ifdef DWT_CTRL_CYCCNTENA_Msk
+			// Enable trace and DWT cycle counter
+			CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7)
+			// Cortex-M7 DWT ignores writes until software lock is released
+			DWT->LAR = 0xC5ACCE55;
+#endif // __CORTEX_M
+			DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif // DWT_CTRL_CYCCNTENA_Msk
+
+			// Rounded up, so converted periods never end early
+			unitsPerUs = (uint32_t)((((uint64_t)getFreq() << usShift) + 999999) / 1000000);
+		}
+
+		/**
+		 * @brief Get current timestamp.
+		 * 
+		 * @return Timestamp in \ref getFreq units.
+		 */
+		static inline uint32_t now(void)
+		{
+#ifdef DWT_CTRL_CYCCNTENA_Msk
+			return DWT->CYCCNT;
+#else
+			return SWDT_GET_TICK();
+#endif // DWT_CTRL_CYCCNTENA_Msk
+		}
+
+		/**
+		 * @brief Get timestamp frequency.
+		 * 
+		 * @return Timestamp frequency in Hz.
+		 */
+		static inline uint32_t getFreq(void)
+		{
+#ifdef DWT_CTRL_CYCCNTENA_Msk
+			return SystemCoreClock;
+#else
+			return 1000;
+#endif // DWT_CTRL_CYCCNTENA_Msk
+		}
+
+		/**
+		 * @brief Convert milliseconds to timestamp units without division.
+		 * 
+		 * Uses same timestamp frequency as \ref fromUs.
+		 * 
+		 * @param ms Time in ms.
+		 * @return Time in timestamp units. Limited to half of timestamp range so differences stay wrap-safe.
+		 * @note \ref init has to be called before this method is used.
+		 */
+		static uint32_t fromMs(const uint32_t ms)
+		{
+			// Split fixed point product, so multiplication by 1000 does not overflow
+			const uint64_t scaled = (uint64_t)ms * unitsPerUs;
+			const uint64_t ticks = ((scaled >> usShift) * 1000) + (((scaled & ((1ULL << usShift) - 1)) * 1000) >> usShift);
+			return (ticks > 0x7FFFFFFF) ? 0x7FFFFFFF : (uint32_t)ticks;
+		}
+
+		/**
+		 * @brief Convert microseconds to timestamp units without division.
+		 * 
+		 * Result is rounded up, so converted periods never end early.
+		 * 
+		 * @param us Time in us.
+		 * @return Time in timestamp units. Limited to half of timestamp range so differences stay wrap-safe.
+		 * @note \ref init has to be called before this method is used.
+		 */
+		static uint32_t fromUs(const uint32_t us)
+		{
+			const uint64_t ticks = ((uint64_t)us * unitsPerUs) >> usShift;
+			return (ticks > 0x7FFFFFFF) ? 0x7FFFFFFF : (uint32_t)ticks;
+		}
+
+
+		private:
+		// CONSTANTS
+		static constexpr uint8_t usShift = 20; /**< @brief Fraction bits of timestamp units per us. */
+
+		// VARIABLES
+#ifdef DWT_CTRL_CYCCNTENA_Msk
+		static inline uint32_t unitsPerUs = 0; /**< @brief Timestamp units per us in fixed point. Set by \ref init, periods converted before are \c 0, so lazy feed feeds on every call. */
+#else
+		static inline uint32_t unitsPerUs = (uint32_t)(((1000ULL << usShift) + 999999) / 1000000); /**< @brief Timestamp units per us in fixed point. */
+#endif // DWT_CTRL_CYCCNTENA_Msk
+	};
+
 	// MAIN CLASS
 	template<class C>
 	class SWDT
@@ -66,163 +283,4062 @@ namespace SWDT
 		}
 
 
-		inline void start() const
+		inline void start(void)
 		{
-			static_cast<C>(this)->start();
+			static_cast<C*>(this)->start();
 		}
 
-		inline void feed(void) const
+		inline void feed(void)
 		{
-			static_cast<C>(this)->feed();
+			static_cast<C*>(this)->feed();
 		}
 
-		inline void setTimeout(uint32_t timeout) const
+		inline void setTimeout(uint32_t timeout)
 		{
-			static_cast<C>(this)->setTimeout(timeout);
+			static_cast<C*>(this)->setTimeout(timeout);
 		}
 
 		inline void setInputFreq(uint32_t value)
 		{
-			static_cast<C>(this)->setInputFreq(value);
+			static_cast<C*>(this)->setInputFreq(value);
 		}
 	};
 
-	// CLASS FOR STM32 IWDG
-	class IWDG : SWDT<IWDG>
+	// TRAITS
+	/**
+	 * @brief Check if \p T is watchdog driver built on \ref SWDT base.
+	 * 
+	 * @tparam T Type to check.
+	 */
+	template<class T, class = void>
+	struct is_watchdog : std::false_type
 	{
-		public:
-		IWDG(void)
+
+	};
+
+	template<class T>
+	struct is_watchdog<T, std::void_t<
+		decltype(std::declval<T&>().start()),
+		decltype(std::declval<T&>().feed()),
+		decltype(std::declval<T&>().setTimeout(0U)),
+		decltype(std::declval<T&>().setInputFreq(0U))>> : std::is_base_of<SWDT<T>, T>
+	{
+
+	};
+
+	template<class T>
+	inline constexpr bool is_watchdog_v = is_watchdog<T>::value; /**< @brief \c true if \p T is watchdog driver. */
+
+#ifdef __cpp_concepts
+	template<class T>
+	concept Watchdog = is_watchdog_v<T>; /**< @brief Watchdog driver concept. */
+#endif // __cpp_concepts
+
+	// IWDG TRAITS
+	/**
+	 * @brief IWDG register layout traits per MCU family.
+	 * 
+	 * \ref IWDGTraits selects traits for MCU family from device header family define. Unknown families use \ref Family::Generic built from device header register definitions.
+	 */
+	namespace Family
+	{
+		/**
+		 * @brief STM32F0 IWDG traits.
+		 * 
+		 */
+		struct F0
 		{
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { 0x40003000 }; /**< @brief IWDG instance base addresses. */
+			static constexpr bool window = true; /**< @brief IWDG has WINR register. */
+			static constexpr bool earlyWakeup = false; /**< @brief IWDG has EWCR register. */
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b110; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = 0x07; /**< @brief Mask for all register update flags in SR register. */
+		};
 
-		}
+		/**
+		 * @brief STM32F1 IWDG traits.
+		 * 
+		 */
+		struct F1
+		{
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { 0x40003000 }; /**< @brief IWDG instance base addresses. */
+			static constexpr bool window = false; /**< @brief IWDG has WINR register. */
+			static constexpr bool earlyWakeup = false; /**< @brief IWDG has EWCR register. */
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b110; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = 0x03; /**< @brief Mask for all register update flags in SR register. */
+		};
 
-		~IWDG(void)
+		/**
+		 * @brief STM32F4 IWDG traits.
+		 * 
+		 */
+		struct F4
 		{
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { 0x40003000 }; /**< @brief IWDG instance base addresses. */
+			static constexpr bool window = false; /**< @brief IWDG has WINR register. */
+			static constexpr bool earlyWakeup = false; /**< @brief IWDG has EWCR register. */
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b110; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = 0x03; /**< @brief Mask for all register update flags in SR register. */
+		};
 
-		}
+		/**
+		 * @brief STM32F7 IWDG traits.
+		 * 
+		 */
+		struct F7
+		{
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { 0x40003000 }; /**< @brief IWDG instance base addresses. */
+			static constexpr bool window = true; /**< @brief IWDG has WINR register. */
+			static constexpr bool earlyWakeup = false; /**< @brief IWDG has EWCR register. */
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b110; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = 0x07; /**< @brief Mask for all register update flags in SR register. */
+		};
 
+		/**
+		 * @brief STM32L0 IWDG traits.
+		 * 
+		 */
+		struct L0
+		{
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { 0x40003000 }; /**< @brief IWDG instance base addresses. */
+			static constexpr bool window = true; /**< @brief IWDG has WINR register. */
+			static constexpr bool earlyWakeup = false; /**< @brief IWDG has EWCR register. */
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b110; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = 0x07; /**< @brief Mask for all register update flags in SR register. */
+		};
 
-		void start(void) const
+		/**
+		 * @brief STM32L4 IWDG traits.
+		 * 
+		 */
+		struct L4
 		{
-			IWDG->KR = startKey;
-		}
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { 0x40003000 }; /**< @brief IWDG instance base addresses. */
+			static constexpr bool window = true; /**< @brief IWDG has WINR register. */
+			static constexpr bool earlyWakeup = false; /**< @brief IWDG has EWCR register. */
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b110; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = 0x07; /**< @brief Mask for all register update flags in SR register. */
+		};
 
-		void feed(void) const
+		/**
+		 * @brief STM32G0 IWDG traits.
+		 * 
+		 */
+		struct G0
 		{
-			IWDG->KR = reloadKey;
-		}
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { 0x40003000 }; /**< @brief IWDG instance base addresses. */
+			static constexpr bool window = true; /**< @brief IWDG has WINR register. */
+			static constexpr bool earlyWakeup = false; /**< @brief IWDG has EWCR register. */
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b110; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = 0x07; /**< @brief Mask for all register update flags in SR register. */
+		};
 
-		void setTimeout(uint32_t timeout) const
+		/**
+		 * @brief STM32G4 IWDG traits.
+		 * 
+		 */
+		struct G4
 		{
-			// Set prescaler to max
-			setPrescaler(Prescaler_t::Div256);
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { 0x40003000 }; /**< @brief IWDG instance base addresses. */
+			static constexpr bool window = true; /**< @brief IWDG has WINR register. */
+			static constexpr bool earlyWakeup = false; /**< @brief IWDG has EWCR register. */
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b110; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = 0x07; /**< @brief Mask for all register update flags in SR register. */
+		};
 
-			// Set required reload value
-			setReloadValue(timeout / (1000 / (freq / 256)));
+#if defined(IWDG1_BASE)
+		/**
+		 * @brief STM32H7 IWDG traits. Dual-core devices have IWDG1 for CM7 and IWDG2 for CM4.
+		 * 
+		 */
+		struct H7
+		{
+#if defined(IWDG2_BASE)
+			static constexpr uint8_t instances = 2; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { IWDG1_BASE, IWDG2_BASE }; /**< @brief IWDG instance base addresses. */
+#else
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { IWDG1_BASE }; /**< @brief IWDG instance base addresses. */
+#endif // IWDG2_BASE
+			static constexpr bool window = true; /**< @brief IWDG has WINR register. */
+			static constexpr bool earlyWakeup = false; /**< @brief IWDG has EWCR register. */
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b110; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = 0x07; /**< @brief Mask for all register update flags in SR register. */
+		};
+#endif // IWDG1_BASE
 
-		}
+		/**
+		 * @brief STM32U5 IWDG traits.
+		 * 
+		 */
+		struct U5
+		{
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { 0x40003000 }; /**< @brief IWDG instance base addresses. */
+			static constexpr bool window = true; /**< @brief IWDG has WINR register. */
+			static constexpr bool earlyWakeup = true; /**< @brief IWDG has EWCR register. */
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b1000; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = 0x0F; /**< @brief Mask for all register update flags in SR register. */
+		};
 
-		void setInputFreq(uint32_t value)
+#if defined(IWDG_BASE)
+		/**
+		 * @brief Generic IWDG traits built from device header register definitions.
+		 * 
+		 */
+		struct Generic
 		{
-			freq = value;
-		}
+			static constexpr uint8_t instances = 1; /**< @brief Number of IWDG instances. */
+			static constexpr uint32_t base[instances] = { IWDG_BASE }; /**< @brief IWDG instance base addresses. */
+#ifdef IWDG_WINR_WIN
+			static constexpr bool window = true; /**< @brief IWDG has WINR register. */
+#else
+			static constexpr bool window = false; /**< @brief IWDG has WINR register. */
+#endif // IWDG_WINR_WIN
+#ifdef IWDG_EWCR_EWIE
+			static constexpr bool earlyWakeup = true; /**< @brief IWDG has EWCR register. */
+#else
+			static constexpr bool earlyWakeup = false; /**< @brief IWDG has EWCR register. */
+#endif // IWDG_EWCR_EWIE
+			static constexpr uint16_t maxReload = 0x0FFF; /**< @brief Maximum reload value. */
+			static constexpr uint8_t maxPrescaler = 0b110; /**< @brief Maximum prescaler register value. */
+			static constexpr uint32_t updateMask = window ? 0x07 : 0x03; /**< @brief Mask for all register update flags in SR register. */
+		};
+#endif // IWDG_BASE
+	};
 
+#if defined(STM32F0)
+	using IWDGTraits = Family::F0; /**< @brief IWDG traits for target MCU family. */
+#elif defined(STM32F1)
+	using IWDGTraits = Family::F1; /**< @brief IWDG traits for target MCU family. */
+#elif defined(STM32F4)
+	using IWDGTraits = Family::F4; /**< @brief IWDG traits for target MCU family. */
+#elif defined(STM32F7)
+	using IWDGTraits = Family::F7; /**< @brief IWDG traits for target MCU family. */
+#elif defined(STM32L0)
+	using IWDGTraits = Family::L0; /**< @brief IWDG traits for target MCU family. */
+#elif defined(STM32L4)
+	using IWDGTraits = Family::L4; /**< @brief IWDG traits for target MCU family. */
+#elif defined(STM32G0)
+	using IWDGTraits = Family::G0; /**< @brief IWDG traits for target MCU family. */
+#elif defined(STM32G4)
+	using IWDGTraits = Family::G4; /**< @brief IWDG traits for target MCU family. */
+#elif defined(STM32H7)
+	using IWDGTraits = Family::H7; /**< @brief IWDG traits for target MCU family. */
+#elif defined(STM32U5)
+	using IWDGTraits = Family::U5; /**< @brief IWDG traits for target MCU family. */
+#else
+	using IWDGTraits = Family::Generic; /**< @brief IWDG traits for target MCU family. */
+#endif // STM32F0
 
-		private:
-		// CONSTANTS
-		constexpr uint16_t reloadKey = 0xAAAA; /**< @brief Reload key for IWDG. */
-		constexpr uint16_t accessKey = 0x5555; /**< @brief Access key for IWDG. */
-		constexpr uint16_t startKey = 0xCCCC; /**< @brief Start key for IWDG. */
-		constexpr uint16_t maxReloadValue = 4095; /**< @brief Maximum reload value for IWDG. */
+	// REGISTER ACCESS
+	/**
+	 * @brief IWDG registers.
+	 * 
+	 */
+	enum class IWDGReg_t : uint8_t {
+		KR = 0, /**< @brief Key register. */
+		PR, /**< @brief Prescaler register. */
+		RLR, /**< @brief Reload register. */
+		SR, /**< @brief Status register. */
+		WINR, /**< @brief Window register. Available only on MCUs with IWDG window. */
+		EWCR /**< @brief Early wakeup register. Available only on MCUs with IWDG early wakeup. */
+	};
 
-		// ENUMS
-		enum class Prescaler_t : uint8_t {
-			Div4 = 0b000, /**< @brief IWDG clock prescaler 4. */
-			Div8 = 0b001, /**< @brief IWDG clock prescaler 8. */
-			Div16 = 0b010, /**< @brief IWDG clock prescaler 16. */
-			Div32 = 0b011, /**< @brief IWDG clock prescaler 32. */
-			Div64 = 0b100, /**< @brief IWDG clock prescaler 64. */
-			Div128 = 0b101, /**< @brief IWDG clock prescaler 128. */
-			Div256 = 0b110 /**< @brief IWDG clock prescaler 256. */
-		};
+	/**
+	 * @brief WWDG registers.
+	 * 
+	 */
+	enum class WWDGReg_t : uint8_t {
+		CR = 0, /**< @brief Control register. */
+		CFR, /**< @brief Configuration register. */
+		SR /**< @brief Status register. */
+	};
 
-		// VARIABLES
-		uint32_t freq = 32000; /**< @brief IWDG input clock freq. */
+#if defined(CORE_CM4)
+	inline constexpr uint32_t iwdgBase = IWDGTraits::base[IWDGTraits::instances - 1]; /**< @brief Base address of IWDG instance for this core. */
+#else
+	inline constexpr uint32_t iwdgBase = IWDGTraits::base[0]; /**< @brief Base address of IWDG instance for this core. */
+#endif // CORE_CM4
 
-		// METHOD DEFINITIONS
+#if defined(WWDG2_BASE) && defined(CORE_CM4)
+	inline constexpr uint32_t wwdgBase = WWDG2_BASE; /**< @brief Base address of WWDG instance for this core. */
+#elif defined(WWDG1_BASE)
+	inline constexpr uint32_t wwdgBase = WWDG1_BASE; /**< @brief Base address of WWDG instance for this core. */
+#else
+	inline constexpr uint32_t wwdgBase = WWDG_BASE; /**< @brief Base address of WWDG instance for this core. */
+#endif // WWDG2_BASE && CORE_CM4
+
+	/**
+	 * @brief Memory-mapped IWDG register access. Default register access policy for \ref BasicIWDG.
+	 * 
+	 * Register access policy provides static \c read and \c write methods. Replace it to run driver off-target.
+	 * 
+	 * @tparam B IWDG instance base address.
+	 */
+	template<uint32_t B = iwdgBase>
+	struct IWDGMemory
+	{
 		/**
-		 * @brief Enable register write access.
+		 * @brief Read IWDG register.
 		 * 
-		 * @return No return value.
+		 * @param reg Register to read.
+		 * @return Register value.
 		 */
-		inline void enableAccess(void) const
+		static inline uint32_t read(const IWDGReg_t reg)
 		{
-			// Write access value to KR register to unlock register protection
-			IWDG->KR = accessKey;
+			IWDG_TypeDef* iwdg = (IWDG_TypeDef*)(uintptr_t)B;
+
+			switch (reg)
+			{
+				case IWDGReg_t::PR: return iwdg->PR;
+				case IWDGReg_t::RLR: return iwdg->RLR;
+				case IWDGReg_t::SR: return iwdg->SR;
+#ifdef IWDG_WINR_WIN
+				case IWDGReg_t::WINR: return iwdg->WINR;
+#endif // IWDG_WINR_WIN
+#ifdef IWDG_EWCR_EWIE
+				case IWDGReg_t::EWCR: return iwdg->EWCR;
+#endif // IWDG_EWCR_EWIE
+				default: return 0;
+			}
 		}
 
-		void setReloadValue(uint32_t value) const
+		/**
+		 * @brief Write IWDG register.
+		 * 
+		 * @param reg Register to write.
+		 * @param value Value to write.
+		 * @return No return value.
+		 */
+		static inline void write(const IWDGReg_t reg, const uint32_t value)
 		{
-			if (value > maxReloadValue)
+			IWDG_TypeDef* iwdg = (IWDG_TypeDef*)(uintptr_t)B;
+
+			switch (reg)
 			{
-				value = maxReloadValue;
+				case IWDGReg_t::KR: iwdg->KR = value; break;
+				case IWDGReg_t::PR: iwdg->PR = value; break;
+				case IWDGReg_t::RLR: iwdg->RLR = value; break;
+#ifdef IWDG_WINR_WIN
+				case IWDGReg_t::WINR: iwdg->WINR = value; break;
+#endif // IWDG_WINR_WIN
+#ifdef IWDG_EWCR_EWIE
+				case IWDGReg_t::EWCR: iwdg->EWCR = value; break;
+#endif // IWDG_EWCR_EWIE
+				default: break;
 			}
-
-			// Write new reload value
-			IWDG->RLR = value;
 		}
+	};
 
-		void setPrescaler(const Prescaler_t prescaler) const
+	/**
+	 * @brief Memory-mapped WWDG register access. Default register access policy for \ref BasicWWDG.
+	 * 
+	 * @tparam B WWDG instance base address.
+	 */
+	template<uint32_t B = wwdgBase>
+	struct WWDGMemory
+	{
+		/**
+		 * @brief Read WWDG register.
+		 * 
+		 * @param reg Register to read.
+		 * @return Register value.
+		 */
+		static inline uint32_t read(const WWDGReg_t reg)
 		{
-			// Wait if prescaler update is ongoing
-			while (IWDG->SR & IWDG_SR_PVU);
+			WWDG_TypeDef* wwdg = (WWDG_TypeDef*)(uintptr_t)B;
 
-			// Enable write access
-			enableAccess();
+			switch (reg)
+			{
+				case WWDGReg_t::CR: return wwdg->CR;
+				case WWDGReg_t::CFR: return wwdg->CFR;
+				case WWDGReg_t::SR: return wwdg->SR;
+				default: return 0;
+			}
+		}
 
-			// Set new prescaler
-			IWDG->PR = (uint8_t)prescaler;
+		/**
+		 * @brief Write WWDG register.
+		 * 
+		 * @param reg Register to write.
+		 * @param value Value to write.
+		 * @return No return value.
+		 */
+		static inline void write(const WWDGReg_t reg, const uint32_t value)
+		{
+			WWDG_TypeDef* wwdg = (WWDG_TypeDef*)(uintptr_t)B;
 
-			// Feed watchdog
-			feed();
+			switch (reg)
+			{
+				case WWDGReg_t::CR: wwdg->CR = value; break;
+				case WWDGReg_t::CFR: wwdg->CFR = value; break;
+				case WWDGReg_t::SR: wwdg->SR = value; break;
+				default: break;
+			}
 		}
 	};
 
-	// CLASS FOR STM32 WWDG
-	class WWDG : SWDT<WWDG>
+	// FEATURE PROFILES
+	/**
+	 * @brief IWDG driver feature profile.
+	 * 
+	 * Disabled features leave no code and no data members in \ref BasicIWDG. Calling method of disabled feature fails at compile time.
+	 * 
+	 * | Profile				| Features								| RAM (bytes)	| Flash ARMv6-M (bytes)	| Flash ARMv7E-M (bytes)	|
+	 * | --------------------	| ------------------------------------	| -----------	| -------------------	| ---------------------	|
+	 * | \ref Profiles::Minimal	| start, feed, configure				| 1 (empty)		| 192					| 182						|
+	 * | \ref Profiles::Runtime	| + setTimeout, getTimeout, calibrate	| 16			| 996					| 1016						|
+	 * | \ref Profiles::Async	| + beginConfigure, poll, boot			| 28			| 1352					| 1374						|
+	 * | \ref Profiles::Full	| + feedLazy, feedIfAllowed				| 52			| 2348					| 2370						|
+	 * 
+	 * RAM is \c sizeof driver object. Flash is code and constants of all profile methods measured with \c examples/HostBenchmark/size.cpp, clang 14 \c -Os for generic ARMv6-M and ARMv7E-M builds against \c host_mcu.h without DWT and with generic IWDG traits, without runtime library helpers. Flash depends on compiler, device header and used methods.
+	 * 
+	 * @tparam Runtime Runtime timeout calculation, input clock frequency and calibration.
+	 * @tparam Async Non-blocking configuration and fast boot.
+	 * @tparam Lazy Lazy feed. Requires \p Runtime.
+	 * @tparam Window Window tracking for \c feedIfAllowed. Requires \p Runtime.
+	 */
+	template<bool Runtime, bool Async, bool Lazy, bool Window>
+	struct Profile
+	{
+		static_assert(Runtime || (!Lazy && !Window), "Lazy feed and window tracking require runtime feature");
+
+		static constexpr bool runtime = Runtime; /**< @brief Runtime timeout calculation is enabled. */
+		static constexpr bool async = Async; /**< @brief Non-blocking configuration is enabled. */
+		static constexpr bool lazy = Lazy; /**< @brief Lazy feed is enabled. */
+		static constexpr bool window = Window; /**< @brief Window tracking is enabled. */
+	};
+
+	namespace Profiles
+	{
+		using Minimal = Profile<false, false, false, false>; /**< @brief Compile-time configuration only. */
+		using Runtime = Profile<true, false, false, false>; /**< @brief Adds runtime timeout and calibration. */
+		using Async = Profile<true, true, false, false>; /**< @brief Adds non-blocking configuration. */
+		using Full = Profile<true, true, true, true>; /**< @brief All features. */
+	};
+
+	/**
+	 * @brief Non-blocking IWDG configuration states.
+	 * 
+	 */
+	enum class ConfigState_t : uint8_t {
+		Idle = 0, /**< @brief No configuration in progress. */
+		Pending, /**< @brief Waiting for previous register update before write. */
+		Window, /**< @brief Waiting for prescaler and reload update before window write. */
+		Updating /**< @brief Waiting for register update after write. */
+	};
+
+	/**
+	 * @brief IWDG runtime timeout state.
+	 * 
+	 * @tparam E Feature is enabled.
+	 */
+	template<bool E>
+	struct IWDGRuntime
+	{
+		static constexpr uint8_t ratioShift = 16; /**< @brief Fraction bits of input clock ticks per ms. */
+		static constexpr uint8_t msShift = 24; /**< @brief Fraction bits of ms per input clock tick. */
+		static constexpr uint8_t usShift = 16; /**< @brief Fraction bits of us per input clock tick. */
+
+		uint32_t freq = 32000; /**< @brief IWDG input clock freq. */
+		uint32_t ticksPerMs = (uint32_t)((32000ULL << ratioShift) / 1000); /**< @brief IWDG input clock ticks per ms in fixed point. */
+		uint32_t msPerTick = (uint32_t)((1000ULL << msShift) / 32000); /**< @brief ms per IWDG input clock tick in fixed point. */
+		uint32_t usPerTick = (uint32_t)((1000000ULL << usShift) / 32000); /**< @brief us per IWDG input clock tick in fixed point. */
+	};
+
+	template<>
+	struct IWDGRuntime<false>
+	{
+
+	};
+
+	/**
+	 * @brief IWDG non-blocking configuration state.
+	 * 
+	 * @tparam E Feature is enabled.
+	 */
+	template<bool E>
+	struct IWDGAsync
+	{
+		uint32_t tick = 0; /**< @brief Tick of last non-blocking configuration step. */
+		uint16_t pendingReload = 0; /**< @brief Reload value for non-blocking configuration. */
+		uint16_t pendingWindow = 0xFFFF; /**< @brief Window value for non-blocking configuration. */
+		uint8_t pendingPrescaler = 0; /**< @brief Prescaler register value for non-blocking configuration. */
+		ConfigState_t state = ConfigState_t::Idle; /**< @brief Non-blocking configuration state. */
+	};
+
+	template<>
+	struct IWDGAsync<false>
+	{
+
+	};
+
+	/**
+	 * @brief IWDG lazy feed state.
+	 * 
+	 * @tparam E Feature is enabled.
+	 */
+	template<bool E>
+	struct IWDGLazy
+	{
+		uint8_t lazyPercent = 0; /**< @brief Lazy feed period in percents of timeout. */
+		uint32_t lazyPeriod = 0; /**< @brief Lazy feed period in \ref Clock units. */
+		uint32_t lastFeed = 0; /**< @brief Timestamp of last lazy feed. */
+	};
+
+	template<>
+	struct IWDGLazy<false>
+	{
+
+	};
+
+	/**
+	 * @brief IWDG window tracking state.
+	 * 
+	 * @tparam E Feature is enabled.
+	 */
+	template<bool E>
+	struct IWDGWindow
+	{
+		uint32_t windowPeriod = 0; /**< @brief Time after refresh when window opens in \ref Clock units. Includes guard band for input clock tolerance. */
+		uint32_t lastWindowFeed = 0; /**< @brief Timestamp of last refresh made by driver. */
+		uint8_t marginShift = 0; /**< @brief Window guard band as power of 2 fraction of window open time. \c 0 doubles open time and covers input clock running down to 50 % of its frequency. */
+	};
+
+	template<>
+	struct IWDGWindow<false>
+	{
+
+	};
+
+	// CLASS FOR STM32 IWDG
+	/**
+	 * @brief STM32 IWDG driver.
+	 * 
+	 * @tparam R Register access policy.
+	 * @tparam T IWDG traits. Only registers available in traits are accessed.
+	 * @tparam F Feature profile. See \ref Profile.
+	 */
+	template<class R = IWDGMemory<>, class T = IWDGTraits, class F = SWDT_PROFILE>
+	class BasicIWDG : public SWDT<BasicIWDG<R, T, F>>, private IWDGRuntime<F::runtime>, private IWDGAsync<F::async>, private IWDGLazy<F::lazy>, private IWDGWindow<F::window>
 	{
 		public:
-		WWDG(void)
+		// ENUMS
+		enum class Prescaler_t : uint8_t {
+			Div4 = 0b000, /**< @brief IWDG clock prescaler 4. */
+			Div8 = 0b001, /**< @brief IWDG clock prescaler 8. */
+			Div16 = 0b010, /**< @brief IWDG clock prescaler 16. */
+			Div32 = 0b011, /**< @brief IWDG clock prescaler 32. */
+			Div64 = 0b100, /**< @brief IWDG clock prescaler 64. */
+			Div128 = 0b101, /**< @brief IWDG clock prescaler 128. */
+			Div256 = 0b110, /**< @brief IWDG clock prescaler 256. */
+			Div512 = 0b111, /**< @brief IWDG clock prescaler 512. Only on MCUs with traits \c maxPrescaler \c 0b111 or higher. */
+			Div1024 = 0b1000 /**< @brief IWDG clock prescaler 1024. Only on MCUs with traits \c maxPrescaler \c 0b1000. */
+		};
+
+		BasicIWDG(void)
 		{
 
 		}
 
-		~WWDG(void)
+		~BasicIWDG(void)
 		{
 
 		}
 
+
 		void start(void) const
 		{
-
+			R::write(IWDGReg_t::KR, startKey);
 		}
 
 		void feed(void) const
 		{
-
+			R::write(IWDGReg_t::KR, reloadKey);
 		}
 
-		void setTimeout(uint32_t timeout) const
+		/**
+		 * @brief Set IWDG timeout at runtime.
+		 * 
+		 * Smallest prescaler is selected from precomputed table and all values are calculated with reciprocals of input clock frequency, so no division is executed.
+		 * 
+		 * @param timeout Required timeout in ms. Timeout is limited to range supported by IWDG.
+		 * @return Achieved timeout, prescaler resolution and clamping flag. Zero timing with \ref Status_t::Timeout status if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		Timing_t setTimeout(uint32_t timeout)
 		{
+			static_assert(F::runtime, "Runtime timeout requires profile with runtime feature");
 
-		}
+			// Required timeout in IWDG input clock ticks, rounded to nearest
+			const uint64_t ticks = (((uint64_t)timeout * this->ticksPerMs) + (1UL << (ratioShift - 1))) >> ratioShift;
 
-		void setInputFreq(uint32_t value)
-		{
+			// Find first prescaler that gives reload value within RLR range
+			uint8_t pr = (uint8_t)Prescaler_t::Div4;
+			while (pr < T::maxPrescaler && ticks > prescalerTable.limit[pr])
+			{
+				pr++;
+			}
+
+			// Prescaled ticks rounded to nearest and limited to RLR range
+			uint32_t counts = (uint32_t)((ticks + (2ULL << pr)) >> (pr + 2));
+			bool clamped = false;
+			if (counts > (maxReloadValue + 1UL))
+			{
+				counts = maxReloadValue + 1UL;
+				clamped = true;
+			}
+			else if (!counts)
+			{
+				counts = 1;
+				clamped = true;
+			}
+
+			if (configure((Prescaler_t)pr, (uint16_t)(counts - 1)) != Status_t::Done)
+			{
+				return { 0, 0, clamped, Status_t::Timeout };
+			}
+
+			return calcTiming((Prescaler_t)pr, (uint16_t)(counts - 1), clamped);
+		}
+
+		/**
+		 * @brief Get achieved timing of compile-time configuration.
+		 * 
+		 * @tparam timeout Required timeout in ms.
+		 * @tparam freq IWDG input clock frequency in Hz.
+		 * @return Achieved timeout and prescaler resolution. Configuration out of range fails at compile time, so \c clamped is always \c false.
+		 */
+		template<uint32_t timeout, uint32_t freq = 32000>
+		static constexpr Timing_t getTiming(void)
+		{
+			using Cfg = Config<timeout, freq>;
+
+			return { Cfg::achievedUs, Cfg::resolutionUs, false };
+		}
+
+		/**
+		 * @brief Get achieved timing of programmed configuration.
+		 * 
+		 * @return Achieved timeout and prescaler resolution calculated from PR and RLR registers.
+		 * @return Zero timing with \ref Status_t::Timeout status if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		Timing_t getTiming(void) const
+		{
+			static_assert(F::runtime, "Timing readback requires profile with runtime feature");
+
+			// Register values are valid only when no update is ongoing
+			if (waitUpdate() != Status_t::Done)
+			{
+				return { 0, 0, false, Status_t::Timeout };
+			}
+
+			return calcTiming(readPrescaler(), R::read(IWDGReg_t::RLR) & maxReloadValue, false);
+		}
+
+		/**
+		 * @brief Set IWDG input clock frequency.
+		 * 
+		 * Reciprocals used by runtime timeout calculations are updated here.
+		 * 
+		 * @param value IWDG input clock frequency in Hz.
+		 * @return No return value.
+		 */
+		void setInputFreq(uint32_t value)
+		{
+			static_assert(F::runtime, "Input clock frequency requires profile with runtime feature");
+
+			if (!value)
+			{
+				return;
+			}
+
+			this->freq = value;
+			this->ticksPerMs = (uint32_t)(((uint64_t)value << ratioShift) / 1000);
+			this->msPerTick = (uint32_t)((1000ULL << msShift) / value);
+			this->usPerTick = (uint32_t)((1000000ULL << usShift) / value);
+		}
+
+		/**
+		 * @brief Configure IWDG timeout at compile time.
+		 * 
+		 * Prescaler, reload and window values are computed during build, so no division code is linked.
+		 * 
+		 * @tparam timeout Required timeout in ms.
+		 * @tparam freq IWDG input clock frequency in Hz.
+		 * @tparam minTime Minimum refresh time after previous refresh in ms. Earlier refresh resets MCU. Set to \c 0 to disable window.
+		 * @return No return value.
+		 */
+		template<uint32_t timeout, uint32_t freq = 32000, uint32_t minTime = 0>
+		void configure(void)
+		{
+			using Cfg = Config<timeout, freq, minTime>;
+			static_assert(T::window || !minTime, "IWDG window is not supported on this MCU");
+
+			// Write precomputed prescaler, reload and window values
+			if (writeConfig(Cfg::prescaler, Cfg::reload, Cfg::window) == Status_t::Done)
+			{
+				// Update lazy feed and window periods
+				updateLazyPeriod(Cfg::achievedUs);
+				updateWindowPeriod(Cfg::windowOpen, Cfg::achievedUs);
+			}
+		}
+
+		/**
+		 * @brief Configure IWDG prescaler, reload and window values.
+		 * 
+		 * Registers are unlocked once and written together. Window is written last and reloads counter, reload key is written after all register updates only if window is disabled.
+		 * 
+		 * @param prescaler New IWDG prescaler. Limited to largest prescaler of MCU.
+		 * @param reload New IWDG reload value.
+		 * @param window New IWDG window value. Used only on MCUs with IWDG window. Default value disables window.
+		 * @return \ref Status_t::Done if configuration is finished.
+		 * @return \ref Status_t::Timeout if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		Status_t configure(const Prescaler_t prescaler, const uint16_t reload, const uint16_t window = maxReloadValue)
+		{
+			const Prescaler_t pr = limitPrescaler(prescaler);
+			const uint16_t rlr = (reload > maxReloadValue) ? maxReloadValue : reload;
+			const uint16_t winr = (window > maxReloadValue) ? maxReloadValue : window;
+
+			const Status_t status = writeConfig(pr, rlr, winr);
+			if (status == Status_t::Done)
+			{
+				// Update lazy feed and window periods
+				if constexpr (F::lazy || (T::window && F::window))
+				{
+					const uint32_t timeout = calcTiming(pr, rlr, false).timeout;
+
+					updateLazyPeriod(timeout);
+					if constexpr (T::window && F::window)
+					{
+						updateWindowPeriod(calcWindowOpen(pr, rlr, winr), timeout);
+					}
+				}
+			}
+
+			return status;
+		}
+
+		/**
+		 * @brief Start non-blocking IWDG configuration.
+		 * 
+		 * Registers are written once ongoing register update is finished. Call \ref poll until it stops returning \ref Status_t::Busy.
+		 * 
+		 * @param prescaler New IWDG prescaler. Limited to largest prescaler of MCU.
+		 * @param reload New IWDG reload value.
+		 * @param window New IWDG window value. Used only on MCUs with IWDG window. Default value disables window.
+		 * @return \ref Status_t::Busy if configuration is in progress.
+		 * @return \ref Status_t::Done if configuration is finished.
+		 * @return \ref Status_t::Timeout if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		Status_t beginConfigure(const Prescaler_t prescaler, const uint16_t reload, const uint16_t window = maxReloadValue)
+		{
+			static_assert(F::async, "Non-blocking configuration requires profile with async feature");
+
+			// Store new configuration
+			this->pendingPrescaler = (uint8_t)limitPrescaler(prescaler);
+			this->pendingReload = (reload > maxReloadValue) ? maxReloadValue : reload;
+			this->pendingWindow = (window > maxReloadValue) ? maxReloadValue : window;
+
+			// Start configuration
+			this->state = ConfigState_t::Pending;
+			this->tick = SWDT_GET_TICK();
+
+			return poll();
+		}
+
+		/**
+		 * @brief Start non-blocking IWDG configuration computed at compile time.
+		 * 
+		 * @tparam timeout Required timeout in ms.
+		 * @tparam freq IWDG input clock frequency in Hz.
+		 * @tparam minTime Minimum refresh time after previous refresh in ms. Set to \c 0 to disable window.
+		 * @return \ref Status_t::Busy if configuration is in progress.
+		 * @return \ref Status_t::Timeout if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		template<uint32_t timeout, uint32_t freq = 32000, uint32_t minTime = 0>
+		Status_t beginConfigure(void)
+		{
+			using Cfg = Config<timeout, freq, minTime>;
+			static_assert(T::window || !minTime, "IWDG window is not supported on this MCU");
+
+			return beginConfigure(Cfg::prescaler, Cfg::reload, Cfg::window);
+		}
+
+		/**
+		 * @brief Advance non-blocking IWDG configuration.
+		 * 
+		 * @return \ref Status_t::Busy if configuration is in progress.
+		 * @return \ref Status_t::Done if configuration is finished or no configuration was started.
+		 * @return \ref Status_t::Timeout if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		Status_t poll(void)
+		{
+			static_assert(F::async, "Non-blocking configuration requires profile with async feature");
+
+			switch (this->state)
+			{
+				case ConfigState_t::Pending:
+				{
+					// Wait for previous register update
+					if (R::read(IWDGReg_t::SR) & updateMask)
+					{
+						return checkDeadline();
+					}
+
+					// Enable write access
+					enableAccess();
+
+					// Write new prescaler and reload values
+					R::write(IWDGReg_t::PR, this->pendingPrescaler);
+					R::write(IWDGReg_t::RLR, this->pendingReload);
+
+					// Wait for register update in next poll, window is written last
+					this->state = T::window ? ConfigState_t::Window : ConfigState_t::Updating;
+					this->tick = SWDT_GET_TICK();
+					return Status_t::Busy;
+				}
+
+				case ConfigState_t::Window:
+				{
+					// Wait for prescaler and reload update
+					if (R::read(IWDGReg_t::SR) & updateMask)
+					{
+						return checkDeadline();
+					}
+
+					// Feed between poll calls locks registers again
+					enableAccess();
+
+					// Window write reloads counter with new configuration
+					R::write(IWDGReg_t::WINR, this->pendingWindow);
+					markRefresh();
+
+					// Wait for window update in next poll
+					this->state = ConfigState_t::Updating;
+					this->tick = SWDT_GET_TICK();
+					return Status_t::Busy;
+				}
+
+				case ConfigState_t::Updating:
+				{
+					// Wait for register update
+					if (R::read(IWDGReg_t::SR) & updateMask)
+					{
+						return checkDeadline();
+					}
+
+					// Rewrite ignored window value until deadline, previous window stays active otherwise
+					if constexpr (T::window)
+					{
+						if ((R::read(IWDGReg_t::WINR) & maxReloadValue) != this->pendingWindow)
+						{
+							enableAccess();
+							R::write(IWDGReg_t::WINR, this->pendingWindow);
+							markRefresh();
+							return checkDeadline();
+						}
+					}
+
+					// Feed watchdog with new configuration. Refresh before open window resets MCU, counter is already reloaded by window write
+					if (!T::window || this->pendingWindow >= this->pendingReload)
+					{
+						feed();
+						markRefresh();
+					}
+
+					// Update lazy feed and window periods
+					if constexpr (F::lazy || (T::window && F::window))
+					{
+						const uint32_t timeout = calcTiming((Prescaler_t)this->pendingPrescaler, this->pendingReload, false).timeout;
+
+						updateLazyPeriod(timeout);
+						if constexpr (T::window && F::window)
+						{
+							updateWindowPeriod(calcWindowOpen((Prescaler_t)this->pendingPrescaler, this->pendingReload, this->pendingWindow), timeout);
+						}
+					}
+
+					this->state = ConfigState_t::Idle;
+					return Status_t::Done;
+				}
+
+				default:
+				{
+					return Status_t::Done;
+				}
+			}
+		}
+
+		/**
+		 * @brief Start IWDG at boot without blocking.
+		 * 
+		 * If IWDG was started by hardware watchdog option bit, PR, RLR and WINR already hold required configuration and window is disabled, watchdog is only fed. Otherwise IWDG is started and new configuration is written with \ref beginConfigure, so update finishes in later \ref poll calls instead of on boot path.
+		 * 
+		 * @tparam timeout Required timeout in ms.
+		 * @tparam freq IWDG input clock frequency in Hz.
+		 * @tparam minTime Minimum refresh time after previous refresh in ms. Set to \c 0 to disable window.
+		 * @return \ref Status_t::Done if IWDG already runs with required configuration.
+		 * @return \ref Status_t::Busy if configuration is in progress. Call \ref poll until it stops returning \ref Status_t::Busy.
+		 * @return \ref Status_t::Timeout if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		template<uint32_t timeout, uint32_t freq = 32000, uint32_t minTime = 0>
+		Status_t boot(void)
+		{
+			static_assert(F::async, "Fast boot requires profile with async feature");
+
+			using Cfg = Config<timeout, freq, minTime>;
+			static_assert(T::window || !minTime, "IWDG window is not supported on this MCU");
+
+			// Refresh before open window resets MCU, so window configuration is always rewritten
+			if (Cfg::window >= Cfg::reload && isHardwareStarted() && isConfigured(Cfg::prescaler, Cfg::reload, Cfg::window))
+			{
+				feed();
+				markRefresh();
+
+				// Update lazy feed and window periods
+				updateLazyPeriod(Cfg::achievedUs);
+				updateWindowPeriod(Cfg::windowOpen, Cfg::achievedUs);
+				return Status_t::Done;
+			}
+
+			// Defer register update off boot path
+			start();
+			return beginConfigure(Cfg::prescaler, Cfg::reload, Cfg::window);
+		}
+
+		/**
+		 * @brief Check if IWDG is started by hardware at reset.
+		 * 
+		 * @return \c true if hardware watchdog option bit is selected.
+		 * @return \c false if IWDG is started by software or MCU has no hardware watchdog option bit.
+		 */
+		static bool isHardwareStarted(void)
+		{
+#if defined(FLASH_OPTR_IWDG_SW)
+			return !(FLASH->OPTR & FLASH_OPTR_IWDG_SW);
+#elif defined(FLASH_OPTR_WDG_SW)
+			// STM32L0 names option bit without IWDG prefix
+			return !(FLASH->OPTR & FLASH_OPTR_WDG_SW);
+#elif defined(FLASH_OPTCR_WDG_SW)
+			return !(FLASH->OPTCR & FLASH_OPTCR_WDG_SW);
+#elif defined(FLASH_OPTSR_IWDG2_SW) && defined(CORE_CM4)
+			return !(FLASH->OPTSR_CUR & FLASH_OPTSR_IWDG2_SW);
+#elif defined(FLASH_OPTSR_IWDG1_SW)
+			return !(FLASH->OPTSR_CUR & FLASH_OPTSR_IWDG1_SW);
+#elif defined(FLASH_OBR_IWDG_SW)
+			return !(FLASH->OBR & FLASH_OBR_IWDG_SW);
+#elif defined(FLASH_OBR_WDG_SW)
+			return !(FLASH->OBR & FLASH_OBR_WDG_SW);
+#else
+			return false;
+#endif // FLASH_OPTR_IWDG_SW
+		}
+
+		/**
+		 * @brief Get programmed IWDG timeout.
+		 * 
+		 * @return Timeout in ms calculated from PR and RLR registers. \c 0 if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		uint32_t getTimeout(void) const
+		{
+			static_assert(F::runtime, "Timeout readback requires profile with runtime feature");
+
+			// Register values are valid only when no update is ongoing
+			if (waitUpdate() != Status_t::Done)
+			{
+				return 0;
+			}
+
+			return calcTimeout(readPrescaler(), R::read(IWDGReg_t::RLR) & maxReloadValue);
+		}
+
+		/**
+		 * @brief Set lazy feed period.
+		 * 
+		 * \ref feedLazy skips register write until \p percent of programmed timeout passed since last lazy feed. Period is derived from PR and RLR values written by driver and from input clock frequency set with \ref setInputFreq or measured with \ref calibrate.
+		 * 
+		 * @param percent Part of timeout window in percents. Limited to 50 %, so lazy feed stays within timeout with LSI running up to 50 % faster than input clock frequency. Set to \c 0 to disable lazy feed.
+		 * @return No return value.
+		 * @note \ref Clock::init has to be called before lazy feed is configured. Period converted before \ref Clock::init is \c 0, so \ref feedLazy feeds on every call until period is updated by configuration or by this method.
+		 */
+		void setLazyFeed(const uint8_t percent)
+		{
+			static_assert(F::lazy, "Lazy feed requires profile with lazy feature");
+
+			this->lazyPercent = (percent > maxLazyPercent) ? maxLazyPercent : percent;
+			updateLazyPeriod(getTiming().timeout);
+		}
+
+		/**
+		 * @brief Feed watchdog only if lazy feed period passed since last lazy feed.
+		 * 
+		 * @return No return value.
+		 * @note \ref feed does not restart lazy feed period.
+		 */
+		inline void feedLazy(void)
+		{
+			static_assert(F::lazy, "Lazy feed requires profile with lazy feature");
+
+			const uint32_t now = Clock::now();
+
+			// Skip register write if lazy feed period did not pass
+			if ((now - this->lastFeed) < this->lazyPeriod)
+			{
+				return;
+			}
+
+			this->lastFeed = now;
+			feed();
+		}
+
+		/**
+		 * @brief Feed watchdog only if IWDG window is open.
+		 * 
+		 * IWDG counter is not readable, so window state is tracked with \ref Clock timestamp of last refresh made by this method or by configuration methods and window period derived from PR, RLR and WINR values written by driver. Window period includes guard band equal to window open time, so input clock may run down to 50 % of its frequency, and is limited to half of timeout. After \ref calibrate guard band is 12.5 % of window open time. Minimum refresh time has to stay below third of timeout, so guarded window still opens before timeout with input clock running up to 50 % faster.
+		 * 
+		 * @return \c true if watchdog is fed.
+		 * @return \c false if window is not open yet.
+		 * @note \ref Clock::init has to be called before this method is used. \ref feed does not restart window period.
+		 */
+		inline bool feedIfAllowed(void)
+		{
+			static_assert(F::window, "Window tracking requires profile with window feature");
+
+			const uint32_t now = Clock::now();
+
+			// Refresh before window opens resets MCU
+			if ((now - this->lastWindowFeed) < this->windowPeriod)
+			{
+				return false;
+			}
+
+			this->lastWindowFeed = now;
+			feed();
+			return true;
+		}
+
+		/**
+		 * @brief Enable IWDG early wakeup interrupt.
+		 * 
+		 * Available only on MCUs with IWDG early wakeup register.
+		 * 
+		 * @param compare Counter value that triggers early wakeup interrupt.
+		 * @return \ref Status_t::Done if early wakeup is configured.
+		 * @return \ref Status_t::Timeout if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		Status_t setEarlyWakeup(const uint16_t compare) const
+		{
+			static_assert(T::earlyWakeup, "IWDG early wakeup is not supported on this MCU");
+
+			// Wait if register update is ongoing
+			if (waitUpdate() != Status_t::Done)
+			{
+				return Status_t::Timeout;
+			}
+
+			// Enable write access and set early wakeup compare value
+			enableAccess();
+			R::write(IWDGReg_t::EWCR, earlyWakeupEnable | (compare & maxReloadValue));
+
+			return waitUpdate();
+		}
+
+		/**
+		 * @brief Check if IWDG counter is frozen in STOP mode.
+		 * 
+		 * @return \c true if IWDG_STOP option bit freezes IWDG counter in STOP mode.
+		 * @return \c false if IWDG counter runs in STOP mode or MCU has no IWDG_STOP option bit.
+		 */
+		static bool isFrozenInStop(void)
+		{
+#if defined(FLASH_OPTR_IWDG_STOP)
+			return !(FLASH->OPTR & FLASH_OPTR_IWDG_STOP);
+#elif defined(FLASH_OPTCR_IWDG_STOP)
+			return !(FLASH->OPTCR & FLASH_OPTCR_IWDG_STOP);
+#elif defined(FLASH_OPTSR_FZ_IWDG_STOP)
+			return !(FLASH->OPTSR_CUR & FLASH_OPTSR_FZ_IWDG_STOP);
+#else
+			return false;
+#endif // FLASH_OPTR_IWDG_STOP
+		}
+
+		/**
+		 * @brief Check if IWDG counter is frozen in STANDBY mode.
+		 * 
+		 * @return \c true if IWDG_STDBY option bit freezes IWDG counter in STANDBY mode.
+		 * @return \c false if IWDG counter runs in STANDBY mode or MCU has no IWDG_STDBY option bit.
+		 */
+		static bool isFrozenInStandby(void)
+		{
+#if defined(FLASH_OPTR_IWDG_STDBY)
+			return !(FLASH->OPTR & FLASH_OPTR_IWDG_STDBY);
+#elif defined(FLASH_OPTCR_IWDG_STDBY)
+			return !(FLASH->OPTCR & FLASH_OPTCR_IWDG_STDBY);
+#elif defined(FLASH_OPTSR_FZ_IWDG_SDBY)
+			return !(FLASH->OPTSR_CUR & FLASH_OPTSR_FZ_IWDG_SDBY);
+#else
+			return false;
+#endif // FLASH_OPTR_IWDG_STDBY
+		}
+
+		/**
+		 * @brief Validate IWDG low-power option bits.
+		 * 
+		 * @param freezeStop Required IWDG counter freeze in STOP mode.
+		 * @param freezeStandby Required IWDG counter freeze in STANDBY mode.
+		 * @return \c true if option bits match required configuration.
+		 * @return \c false otherwise.
+		 */
+		static bool validateLowPower(const bool freezeStop, const bool freezeStandby)
+		{
+			return (isFrozenInStop() == freezeStop) && (isFrozenInStandby() == freezeStandby);
+		}
+
+		/**
+		 * @brief Get RTC wakeup timer reload value aligned to programmed IWDG timeout.
+		 * 
+		 * MCU woken by RTC wakeup timer with this reload value wakes once per watchdog period, \p percent of timeout after previous wakeup.
+		 * 
+		 * @param rtcFreq RTC wakeup timer clock frequency in Hz, for example RTCCLK / 16.
+		 * @param percent Wakeup period in percents of programmed timeout.
+		 * @return Value for RTC WUTR register. Limited to 16-bit range.
+		 */
+		uint16_t getRTCWakeup(const uint32_t rtcFreq, const uint8_t percent) const
+		{
+			static_assert(F::runtime, "RTC wakeup alignment requires profile with runtime feature");
+
+			const uint64_t ticks = ((uint64_t)getTimeout() * percent * rtcFreq) / 100000;
+
+			if (ticks == 0)
+			{
+				return 0;
+			}
+
+			return (ticks > 0x10000) ? 0xFFFF : (uint16_t)(ticks - 1);
+		}
+
+		/**
+		 * @brief Calibrate IWDG input clock frequency with timer input capture.
+		 * 
+		 * Timer channel 1 captures every 8th LSI edge and measured frequency replaces value set with \ref setInputFreq.
+		 * LSI has to be running and routed to timer channel 1 input before calibration, for example TIM14 on F0 (LSI through MCO), TIM16 on L4/G0 or TIM21 on L0.
+		 * 
+		 * @param timer Pointer to timer with LSI on channel 1 input. Timer clock has to be enabled.
+		 * @param timerFreq Timer input clock frequency in Hz.
+		 * @param periods Number of measured periods, each 8 LSI cycles long.
+		 * @return \ref Status_t::Done if calibration is finished.
+		 * @return \ref Status_t::Timeout if capture did not happen within \ref SWDT_TIMEOUT. Input clock frequency is not changed.
+		 */
+		Status_t calibrate(TIM_TypeDef* timer, const uint32_t timerFreq, const uint8_t periods = 16)
+		{
+			static_assert(F::runtime, "Calibration requires profile with runtime feature");
+
+			// Keep 8 LSI cycles within 16-bit capture range
+			const uint32_t psc = timerFreq / calibrationMaxFreq;
+
+			// Configure channel 1 as input capture on TI1 with capture on every 8th edge
+			timer->CR1 = 0;
+			timer->PSC = psc;
+			timer->ARR = 0xFFFF;
+			timer->CCMR1 = TIM_CCMR1_CC1S_0 | TIM_CCMR1_IC1PSC;
+			timer->CCER = TIM_CCER_CC1E;
+			timer->EGR = TIM_EGR_UG;
+			timer->SR = 0;
+			timer->CR1 = TIM_CR1_CEN;
+
+			const uint32_t start = SWDT_GET_TICK();
+			uint32_t sum = 0;
+			uint16_t last = 0;
+
+			// First capture is only reference point
+			for (uint16_t i = 0; i <= periods; i++)
+			{
+				while (!(timer->SR & TIM_SR_CC1IF))
+				{
+					if ((SWDT_GET_TICK() - start) >= SWDT_TIMEOUT)
+					{
+						timer->CR1 = 0;
+						timer->CCER = 0;
+						return Status_t::Timeout;
+					}
+				}
+
+				// Reading capture register clears capture flag
+				const uint16_t capture = (uint16_t)timer->CCR1;
+				if (i)
+				{
+					sum += (uint16_t)(capture - last);
+				}
+				last = capture;
+			}
+
+			// Stop timer
+			timer->CR1 = 0;
+			timer->CCER = 0;
+
+			if (!sum)
+			{
+				return Status_t::Timeout;
+			}
+
+			// Calculate measured frequency
+			setInputFreq((uint32_t)((((uint64_t)timerFreq / (psc + 1)) * 8 * periods + sum / 2) / sum));
+
+			// Update lazy feed and window periods for measured frequency
+			const uint32_t timeout = getTiming().timeout;
+			updateLazyPeriod(timeout);
+			if constexpr (T::window && F::window)
+			{
+				this->marginShift = calibratedMarginShift;
+				updateWindowPeriod(calcWindowOpen(readPrescaler(), R::read(IWDGReg_t::RLR) & maxReloadValue, R::read(IWDGReg_t::WINR) & maxReloadValue), timeout);
+			}
+
+			return Status_t::Done;
+		}
+
+
+		private:
+		// CONSTANTS
+		static constexpr uint16_t reloadKey = 0xAAAA; /**< @brief Reload key for IWDG. */
+		static constexpr uint16_t accessKey = 0x5555; /**< @brief Access key for IWDG. */
+		static constexpr uint16_t startKey = 0xCCCC; /**< @brief Start key for IWDG. */
+		static constexpr uint16_t maxReloadValue = T::maxReload; /**< @brief Maximum reload value for IWDG. */
+		static constexpr uint32_t updateMask = T::updateMask; /**< @brief Mask for all register update flags. */
+		static constexpr uint32_t earlyWakeupEnable = (1UL << 15); /**< @brief EWIE bit in EWCR register. */
+		static constexpr uint32_t calibrationMaxFreq = 100000000; /**< @brief Maximum timer clock frequency during calibration in Hz. */
+		static constexpr uint8_t calibratedMarginShift = 3; /**< @brief Window guard band shift after \ref calibrate. Covers 12.5 % input clock drift. */
+		static constexpr uint8_t percentShift = 22; /**< @brief Fraction bits of one percent scale. */
+		static constexpr uint32_t percentScale = (1UL << percentShift) / 100; /**< @brief One percent in fixed point, so percent of timeout is calculated without division. */
+		static constexpr uint8_t maxLazyPercent = 50; /**< @brief Maximum lazy feed period in percents of timeout. Covers LSI running up to 50 % faster than input clock frequency. */
+		static constexpr uint8_t ratioShift = IWDGRuntime<true>::ratioShift; /**< @brief Fraction bits of input clock ticks per ms. */
+		static constexpr uint8_t msShift = IWDGRuntime<true>::msShift; /**< @brief Fraction bits of ms per input clock tick. */
+		static constexpr uint8_t usShift = IWDGRuntime<true>::usShift; /**< @brief Fraction bits of us per input clock tick. */
+
+		// STRUCTS
+		/**
+		 * @brief Prescaler selection table.
+		 * 
+		 */
+		struct PrescalerTable_t
+		{
+			uint32_t limit[T::maxPrescaler + 1]; /**< @brief Max number of IWDG input clock ticks for each prescaler. */
+		};
+
+		/**
+		 * @brief Generate prescaler selection table.
+		 * 
+		 * @return Table with max number of input clock ticks whose rounded reload value fits in \ref maxReloadValue.
+		 */
+		static constexpr PrescalerTable_t makePrescalerTable(void)
+		{
+			PrescalerTable_t table = {};
+
+			for (uint8_t pr = 0; pr <= T::maxPrescaler; pr++)
+			{
+				table.limit[pr] = (uint32_t)((((maxReloadValue + 2ULL) << (pr + 2)) - (2ULL << pr)) - 1);
+			}
+
+			return table;
+		}
+
+		static constexpr PrescalerTable_t prescalerTable = makePrescalerTable(); /**< @brief Prescaler selection table. */
+
+		/**
+		 * @brief Compile-time IWDG configuration.
+		 * 
+		 * Selects the smallest prescaler whose reload value fits in \ref maxReloadValue and folds PR and RLR values into constants.
+		 * 
+		 * @tparam timeout Required timeout in ms.
+		 * @tparam freq IWDG input clock frequency in Hz.
+		 * @tparam minTime Minimum refresh time in ms. \c 0 disables window.
+		 */
+		template<uint32_t timeout, uint32_t freq, uint32_t minTime = 0>
+		struct Config
+		{
+			static_assert(timeout > 0, "IWDG timeout must be greater than 0");
+			static_assert(minTime < timeout, "IWDG minimum refresh time must be lower than timeout");
+			static_assert(freq > 0, "IWDG input clock frequency must be greater than 0");
+
+			/**
+			 * @brief Find smallest prescaler for required number of IWDG input clock ticks.
+			 * 
+			 * @param ticks Number of IWDG input clock ticks.
+			 * @return Prescaler register value.
+			 */
+			static constexpr uint8_t findPrescaler(const uint64_t ticks)
+			{
+				uint8_t pr = (uint8_t)Prescaler_t::Div4;
+
+				// Find first prescaler that gives reload value within RLR range
+				while (pr < T::maxPrescaler && ((ticks + (2ULL << pr)) >> (pr + 2)) > (maxReloadValue + 1ULL))
+				{
+					pr++;
+				}
+
+				return pr;
+			}
+
+			static constexpr uint64_t ticks = ((uint64_t)timeout * freq + 500) / 1000; /**< @brief Required timeout in IWDG input clock ticks. */
+			static constexpr uint8_t pr = findPrescaler(ticks); /**< @brief Selected prescaler register value. */
+			static constexpr uint64_t counts = (ticks + (2ULL << pr)) >> (pr + 2); /**< @brief Number of prescaled IWDG clock ticks. */
+
+			static_assert(counts >= 1, "IWDG timeout is too short for given input clock frequency");
+			static_assert(counts <= (maxReloadValue + 1ULL), "IWDG timeout is too long for given input clock frequency");
+			static_assert(((uint64_t)minTime * 3) <= timeout, "IWDG minimum refresh time must not exceed third of timeout");
+
+			static constexpr Prescaler_t prescaler = (Prescaler_t)pr; /**< @brief Selected prescaler. */
+			static constexpr uint16_t reload = (uint16_t)(counts - 1); /**< @brief Selected reload value. */
+			static constexpr uint32_t achieved = (uint32_t)(((counts << (pr + 2)) * 1000) / freq); /**< @brief Achieved timeout in ms. */
+			static constexpr uint32_t achievedUs = (uint32_t)(((counts << (pr + 2)) * 1000000) / freq); /**< @brief Achieved timeout in us. */
+			static constexpr uint32_t resolutionUs = (uint32_t)(((1ULL << (pr + 2)) * 1000000) / freq); /**< @brief Timeout step of selected prescaler in us. */
+			static constexpr uint64_t minCounts = (((uint64_t)minTime * freq) / 1000) >> (pr + 2); /**< @brief Minimum refresh time in prescaled IWDG clock ticks. */
+
+			static_assert(counts > minCounts, "IWDG minimum refresh time is too long for selected reload value");
+
+			static constexpr uint16_t window = minTime ? (uint16_t)(reload - minCounts) : maxReloadValue; /**< @brief Selected window value. */
+			static constexpr uint32_t windowOpen = (uint32_t)(((minCounts << (pr + 2)) * 1000000) / freq); /**< @brief Time after refresh when window opens in us. */
+		};
+
+		// METHOD DEFINITIONS
+		/**
+		 * @brief Enable register write access.
+		 * 
+		 * @return No return value.
+		 */
+		inline void enableAccess(void) const
+		{
+			// Write access value to KR register to unlock register protection
+			R::write(IWDGReg_t::KR, accessKey);
+		}
+
+		/**
+		 * @brief Wait for ongoing register update.
+		 * 
+		 * @return \ref Status_t::Done if register update is finished.
+		 * @return \ref Status_t::Timeout if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		Status_t waitUpdate(void) const
+		{
+			const uint32_t start = SWDT_GET_TICK();
+
+			while (R::read(IWDGReg_t::SR) & updateMask)
+			{
+				if ((SWDT_GET_TICK() - start) >= SWDT_TIMEOUT)
+				{
+					return Status_t::Timeout;
+				}
+			}
+
+			return Status_t::Done;
+		}
+
+		/**
+		 * @brief Check if IWDG registers hold given configuration.
+		 * 
+		 * @param prescaler IWDG prescaler.
+		 * @param reload IWDG reload value.
+		 * @param window IWDG window value. Ignored on MCUs without IWDG window.
+		 * @return \c true if no register update is ongoing and PR, RLR and WINR match given values.
+		 * @return \c false otherwise.
+		 */
+		bool isConfigured(const Prescaler_t prescaler, const uint16_t reload, const uint16_t window) const
+		{
+			// Register values are valid only when no update is ongoing
+			if (R::read(IWDGReg_t::SR) & updateMask)
+			{
+				return false;
+			}
+
+			if ((R::read(IWDGReg_t::PR) & 0x0F) != (uint8_t)prescaler || (R::read(IWDGReg_t::RLR) & maxReloadValue) != reload)
+			{
+				return false;
+			}
+
+			if constexpr (T::window)
+			{
+				return (R::read(IWDGReg_t::WINR) & maxReloadValue) == window;
+			}
+
+			return true;
+		}
+
+		/**
+		 * @brief Read programmed prescaler.
+		 * 
+		 * @return Prescaler from PR register, limited to traits prescaler range.
+		 */
+		Prescaler_t readPrescaler(void) const
+		{
+			return limitPrescaler((Prescaler_t)(R::read(IWDGReg_t::PR) & 0x0F));
+		}
+
+		/**
+		 * @brief Limit prescaler to traits prescaler range.
+		 * 
+		 * Larger PR values select the largest divider in hardware, so timing is calculated for that divider.
+		 * 
+		 * @param prescaler IWDG prescaler.
+		 * @return Prescaler not above \c T::maxPrescaler.
+		 */
+		static constexpr Prescaler_t limitPrescaler(const Prescaler_t prescaler)
+		{
+			return ((uint8_t)prescaler > T::maxPrescaler) ? (Prescaler_t)T::maxPrescaler : prescaler;
+		}
+
+		/**
+		 * @brief Calculate timeout for given configuration.
+		 * 
+		 * @param prescaler IWDG prescaler.
+		 * @param reload IWDG reload value.
+		 * @return Timeout in ms.
+		 */
+		uint32_t calcTimeout(const Prescaler_t prescaler, const uint16_t reload) const
+		{
+			return (uint32_t)(((((uint64_t)reload + 1) << ((uint8_t)prescaler + 2)) * this->msPerTick) >> msShift);
+		}
+
+		/**
+		 * @brief Calculate achieved timing for given configuration.
+		 * 
+		 * @param prescaler IWDG prescaler.
+		 * @param reload IWDG reload value.
+		 * @param clamped Required timeout was limited.
+		 * @return Achieved timeout and prescaler resolution.
+		 */
+		Timing_t calcTiming(const Prescaler_t prescaler, const uint16_t reload, const bool clamped) const
+		{
+			const uint8_t shift = (uint8_t)prescaler + 2;
+
+			return {
+				(uint32_t)(((((uint64_t)reload + 1) << shift) * this->usPerTick) >> usShift),
+				(uint32_t)(((1ULL << shift) * this->usPerTick) >> usShift),
+				clamped
+			};
+		}
+
+		/**
+		 * @brief Calculate time after refresh when window opens for given configuration.
+		 * 
+		 * @param prescaler IWDG prescaler.
+		 * @param reload IWDG reload value.
+		 * @param window IWDG window value.
+		 * @return Time in us.
+		 */
+		uint32_t calcWindowOpen(const Prescaler_t prescaler, const uint16_t reload, const uint16_t window) const
+		{
+			if (window >= reload)
+			{
+				return 0;
+			}
+
+			return (uint32_t)(((((uint64_t)reload - window) << ((uint8_t)prescaler + 2)) * this->usPerTick) >> usShift);
+		}
+
+		/**
+		 * @brief Update window period.
+		 * 
+		 * Guard band selected with \c marginShift is added to window open time. Guard band is limited so window period stays within half of timeout, same as \ref maxLazyPercent, otherwise \ref feedIfAllowed would never feed before timeout.
+		 * 
+		 * @param windowOpen Time after refresh when window opens in us.
+		 * @param timeout Timeout in us.
+		 * @return No return value.
+		 */
+		void updateWindowPeriod(const uint32_t windowOpen, const uint32_t timeout)
+		{
+			if constexpr (F::window)
+			{
+				const uint32_t guarded = windowOpen + (windowOpen >> this->marginShift);
+				const uint32_t limit = ((timeout >> 1) > windowOpen) ? (timeout >> 1) : windowOpen;
+
+				this->windowPeriod = Clock::fromUs((guarded > limit) ? limit : guarded);
+			}
+		}
+
+		/**
+		 * @brief Restart window period on refresh made by driver.
+		 * 
+		 * @return No return value.
+		 */
+		inline void markRefresh(void)
+		{
+			if constexpr (F::window)
+			{
+				this->lastWindowFeed = Clock::now();
+			}
+		}
+
+		/**
+		 * @brief Update lazy feed period for new timeout.
+		 * 
+		 * @param timeout New timeout in us.
+		 * @return No return value.
+		 */
+		void updateLazyPeriod(const uint32_t timeout)
+		{
+			if constexpr (F::lazy)
+			{
+				this->lazyPeriod = Clock::fromUs((uint32_t)(((uint64_t)timeout * this->lazyPercent * percentScale) >> percentShift));
+			}
+		}
+
+		/**
+		 * @brief Check non-blocking configuration deadline.
+		 * 
+		 * @return \ref Status_t::Busy if deadline did not expire.
+		 * @return \ref Status_t::Timeout if deadline expired. Configuration is aborted.
+		 */
+		Status_t checkDeadline(void)
+		{
+			if ((SWDT_GET_TICK() - this->tick) < SWDT_TIMEOUT)
+			{
+				return Status_t::Busy;
+			}
+
+			// Abort configuration
+			this->state = ConfigState_t::Idle;
+			return Status_t::Timeout;
+		}
+
+		/**
+		 * @brief Write prescaler, reload and window registers in one unlocked sequence.
+		 * 
+		 * Window is written last after prescaler and reload update is finished, so window write reloads counter with new configuration. Reload key is written only if window is disabled, refresh before open window resets MCU.
+		 * 
+		 * @param prescaler New IWDG prescaler.
+		 * @param reload New IWDG reload value.
+		 * @param window New IWDG window value. Used only on MCUs with IWDG window.
+		 * @return \ref Status_t::Done if configuration is finished.
+		 * @return \ref Status_t::Timeout if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		Status_t writeConfig(const Prescaler_t prescaler, const uint16_t reload, const uint16_t window)
+		{
+			// Wait if previous register update is ongoing
+			if (waitUpdate() != Status_t::Done)
+			{
+				return Status_t::Timeout;
+			}
+
+			// Enable write access
+			enableAccess();
+
+			// Write all registers before access is locked again
+			R::write(IWDGReg_t::PR, (uint8_t)prescaler);
+			R::write(IWDGReg_t::RLR, reload);
+			if constexpr (T::window)
+			{
+				// Window write reloads counter once prescaler and reload are updated
+				if (waitUpdate() != Status_t::Done)
+				{
+					return Status_t::Timeout;
+				}
+
+				R::write(IWDGReg_t::WINR, window);
+				markRefresh();
+			}
+
+			// Wait for all register updates
+			if (waitUpdate() != Status_t::Done)
+			{
+				return Status_t::Timeout;
+			}
+
+			// Feed watchdog with new configuration
+			if (!T::window || window >= reload)
+			{
+				feed();
+				markRefresh();
+			}
+
+			return Status_t::Done;
+		}
+	};
+
+	using IWDGDriver = BasicIWDG<>; /**< @brief STM32 IWDG driver with memory-mapped registers of IWDG instance for this core. */
+
+#if defined(IWDG1_BASE) && defined(IWDG2_BASE)
+	using IWDG1Driver = BasicIWDG<IWDGMemory<IWDG1_BASE>>; /**< @brief STM32H7 IWDG1 driver. Resets CM7 core domain. */
+	using IWDG2Driver = BasicIWDG<IWDGMemory<IWDG2_BASE>>; /**< @brief STM32H7 IWDG2 driver. Resets CM4 core domain. */
+#endif // IWDG1_BASE && IWDG2_BASE
+
+	// CLASS FOR LONG OPERATION GUARD
+	/**
+	 * @brief Scope guard that extends IWDG timeout for long operation.
+	 * 
+	 * Constructor starts non-blocking switch to \p timeout and destructor starts non-blocking switch back to \p normalTimeout. Both configurations are computed at compile time and neither constructor nor destructor waits for register update.
+	 * IWDG loads new reload value with window write or first feed after register update, so call \ref poll within \p normalTimeout after entering scope, for example between flash sectors, instead of feeding in inner loops. Keep polling IWDG after scope ends to finish switch back. Guards must not be nested.
+	 * If \p normalMinTime is set, constructor does not feed, because normal window may not be open yet. Counter is reloaded by window write in \ref poll instead, so first \ref poll has to be called early enough to finish switch before normal timeout.
+	 * After scope exit counter holds long reload value, but counts with normal prescaler as soon as prescaler update is finished. Until \ref poll reloads counter with normal configuration, effective timeout is \ref switchTimeout, which can be shorter than \p normalTimeout (about 625 ms for 10 s long and 1 s normal timeout). Feeds made while reload update is ongoing also load long reload value, so feeding at normal rate does not cover this. Call \ref poll within \ref switchTimeout after scope exit.
+	 * 
+	 * @tparam W IWDG driver class with async feature.
+	 * @tparam timeout Timeout during long operation in ms.
+	 * @tparam normalTimeout Timeout restored at scope exit in ms.
+	 * @tparam freq IWDG input clock frequency in Hz.
+	 * @tparam normalMinTime Minimum refresh time restored at scope exit in ms. Window is disabled during long operation.
+	 */
+	template<class W, uint32_t timeout, uint32_t normalTimeout, uint32_t freq = 32000, uint32_t normalMinTime = 0>
+	class LongOpGuard
+	{
+		static_assert(timeout > normalTimeout, "Long operation timeout must be longer than normal timeout");
+
+		private:
+		// CONSTANTS
+		static constexpr Timing_t longTiming = W::template getTiming<timeout, freq>(); /**< @brief Achieved long operation timing. */
+		static constexpr Timing_t normalTiming = W::template getTiming<normalTimeout, freq>(); /**< @brief Achieved normal timing. */
+		static constexpr uint64_t mixedUs = ((uint64_t)longTiming.timeout * normalTiming.resolution) / longTiming.resolution; /**< @brief Long reload value counted with normal prescaler in us. */
+
+
+		public:
+		static constexpr uint32_t switchTimeout = (uint32_t)(((mixedUs < normalTiming.timeout) ? mixedUs : normalTiming.timeout) / 1000); /**< @brief Shortest effective timeout after scope exit until \ref poll finishes switch back in ms. */
+
+		/**
+		 * @brief Extend IWDG timeout.
+		 * 
+		 * @param watchdog Reference to IWDG driver.
+		 */
+		LongOpGuard(W& watchdog) : wdt(watchdog)
+		{
+			// Restart normal timeout while long timeout is written. Refresh before open window resets MCU
+			if constexpr (normalMinTime == 0)
+			{
+				wdt.feed();
+			}
+			wdt.template beginConfigure<timeout, freq>();
+		}
+
+		/**
+		 * @brief Restore normal IWDG timeout.
+		 * 
+		 */
+		~LongOpGuard(void)
+		{
+			// Feed with long timeout, window is disabled during long operation. Normal timeout is loaded by window write or feed in poll, counter runs with normal prescaler for up to switchTimeout before that
+			wdt.feed();
+			wdt.template beginConfigure<normalTimeout, freq, normalMinTime>();
+		}
+
+		LongOpGuard(const LongOpGuard&) = delete;
+		LongOpGuard& operator=(const LongOpGuard&) = delete;
+
+
+		/**
+		 * @brief Advance timeout switch. Feeds IWDG once register update is finished.
+		 * 
+		 * @return \ref Status_t::Done if long timeout is active.
+		 * @return \ref Status_t::Busy if register update is in progress.
+		 * @return \ref Status_t::Timeout if register update did not finish within \ref SWDT_TIMEOUT.
+		 */
+		inline Status_t poll(void)
+		{
+			return wdt.poll();
+		}
+
+
+		private:
+		// VARIABLES
+		W& wdt; /**< @brief Reference to IWDG driver. */
+	};
+
+	// CLASS FOR STM32 WWDG
+	/**
+	 * @brief STM32 WWDG driver.
+	 * 
+	 * @tparam R Register access policy.
+	 */
+	template<class R = WWDGMemory<>>
+	class BasicWWDG : public SWDT<BasicWWDG<R>>
+	{
+		public:
+		BasicWWDG(void)
+		{
+
+		}
+
+		~BasicWWDG(void)
+		{
+
+		}
+
+		void start(void) const
+		{
+			R::write(WWDGReg_t::CR, WWDG_CR_WDGA | counter);
+		}
+
+		void feed(void) const
+		{
+			R::write(WWDGReg_t::CR, WWDG_CR_WDGA | counter);
+		}
+
+		/**
+		 * @brief Set WWDG timeout at runtime. Window is disabled.
+		 * 
+		 * Smallest prescaler is selected and all values are calculated with reciprocals of input clock frequency, so no division is executed.
+		 * 
+		 * @param timeout Required timeout in ms. Timeout is limited to range supported by WWDG.
+		 * @return Achieved timeout, prescaler resolution and clamping flag.
+		 */
+		Timing_t setTimeout(uint32_t timeout)
+		{
+			// Required timeout in WWDG ticks without prescaler, fixed point
+			const uint64_t ticks = (uint64_t)timeout * ticksPerMs;
+
+			// Find first prescaler that gives counter within range
+			uint8_t tb = 0;
+			while (tb < maxTimebase && ((ticks + (1ULL << (ratioShift + tb - 1))) >> (ratioShift + tb)) > maxTicks)
+			{
+				tb++;
+			}
+
+			// Prescaled ticks rounded to nearest and limited to counter range
+			uint32_t counts = (uint32_t)((ticks + (1ULL << (ratioShift + tb - 1))) >> (ratioShift + tb));
+			bool clamped = false;
+			if (counts > maxTicks)
+			{
+				counts = maxTicks;
+				clamped = true;
+			}
+			else if (!counts)
+			{
+				counts = 1;
+				clamped = true;
+			}
+
+			// Window is disabled
+			setConfig(tb, (uint8_t)(resetCounter + counts), counterMask);
+			return calcTiming(tb, counts, clamped);
+		}
+
+		/**
+		 * @brief Set WWDG input clock frequency.
+		 * 
+		 * Reciprocals used by runtime timeout calculations are updated here.
+		 * 
+		 * @param value WWDG input clock (PCLK) frequency in Hz.
+		 * @return No return value.
+		 */
+		void setInputFreq(uint32_t value)
+		{
+			if (!value)
+			{
+				return;
+			}
+
+			ticksPerMs = (uint32_t)(((uint64_t)value << ratioShift) / (tickCycles * 1000ULL));
+			usPerTick = (uint32_t)(((tickCycles * 1000000ULL) << usShift) / value);
+		}
+
+		/**
+		 * @brief Configure WWDG timeout and window at compile time.
+		 * 
+		 * Prescaler, counter and window values are computed during build. Parameters have same order and units as \ref BasicIWDG::configure.
+		 * 
+		 * @tparam timeout Required timeout in ms. Refresh later than timeout resets MCU.
+		 * @tparam freq WWDG input clock (PCLK) frequency in Hz.
+		 * @tparam minTime Minimum refresh time after previous refresh in ms. Earlier refresh resets MCU. Set to \c 0 to disable window.
+		 * @return No return value.
+		 */
+		template<uint32_t timeout, uint32_t freq = 16000000, uint32_t minTime = 0>
+		void configure(void)
+		{
+			using Cfg = Config<timeout, freq, minTime>;
+
+			setConfig(Cfg::timebase, Cfg::counter, Cfg::window);
+		}
+
+		/**
+		 * @brief Get achieved timing of compile-time configuration.
+		 * 
+		 * @tparam timeout Required timeout in ms.
+		 * @tparam freq WWDG input clock (PCLK) frequency in Hz.
+		 * @tparam minTime Minimum refresh time after previous refresh in ms.
+		 * @return Achieved timeout and prescaler resolution. Configuration out of range fails at compile time, so \c clamped is always \c false.
+		 */
+		template<uint32_t timeout, uint32_t freq = 16000000, uint32_t minTime = 0>
+		static constexpr Timing_t getTiming(void)
+		{
+			using Cfg = Config<timeout, freq, minTime>;
+
+			return { Cfg::achievedUs, Cfg::resolutionUs, false };
+		}
+
+		/**
+		 * @brief Feed watchdog only if WWDG counter is inside refresh window.
+		 * 
+		 * WWDG counter is read only once.
+		 * 
+		 * @return \c true if watchdog is fed.
+		 * @return \c false if WWDG counter is above window value.
+		 */
+		inline bool feedIfInWindow(void) const
+		{
+			if (!isInWindow())
+			{
+				return false;
+			}
+
+			feed();
+			return true;
+		}
+
+		/**
+		 * @brief Check if WWDG counter is inside refresh window.
+		 * 
+		 * @return \c true if refresh is allowed.
+		 * @return \c false if WWDG counter is above window value.
+		 */
+		inline bool isInWindow(void) const
+		{
+			// Refresh above window value resets MCU
+			return (R::read(WWDGReg_t::CR) & counterMask) <= window;
+		}
+
+		/**
+		 * @brief Enable WWDG early wakeup interrupt.
+		 * 
+		 * Interrupt is triggered when WWDG counter reaches \c 0x40, one WWDG tick before reset.
+		 * 
+		 * @param priority WWDG interrupt priority. Default is highest priority.
+		 * @return No return value.
+		 * @note Early wakeup interrupt can be disabled only by reset.
+		 */
+		void enableEWI(const uint32_t priority = 0) const
+		{
+			// Clear pending early wakeup flag
+			R::write(WWDGReg_t::SR, 0);
+
+			// Enable early wakeup interrupt
+			R::write(WWDGReg_t::CFR, R::read(WWDGReg_t::CFR) | WWDG_CFR_EWI);
+			NVIC_SetPriority(WWDG_IRQn, priority);
+			NVIC_EnableIRQ(WWDG_IRQn);
+		}
+
+		/**
+		 * @brief Handle WWDG early wakeup interrupt. Call from \c WWDG_IRQHandler or use \ref SWDT_WWDG_EWI_HANDLER.
+		 * 
+		 * @tparam Hook Early wakeup callback. Called before flag is cleared for minimal latency.
+		 * @return No return value.
+		 */
+		template<void (*Hook)(void)>
+		static inline __attribute__((always_inline)) void handleEWI(void)
+		{
+			Hook();
+
+			// Clear early wakeup flag
+			R::write(WWDGReg_t::SR, 0);
+		}
+
+
+		private:
+		// CONSTANTS
+		static constexpr uint8_t counterMask = 0x7F; /**< @brief Mask for WWDG counter and window value. */
+		static constexpr uint8_t resetCounter = 0x3F; /**< @brief WWDG counter value that resets MCU. */
+		static constexpr uint8_t maxTicks = counterMask - resetCounter; /**< @brief Maximum number of WWDG ticks before reset. */
+		static constexpr uint8_t tickShift = 12; /**< @brief Number of PCLK cycles for one WWDG tick without prescaler as power of 2. */
+		static constexpr uint64_t tickCycles = 1ULL << tickShift; /**< @brief Number of PCLK cycles for one WWDG tick without prescaler. */
+		static constexpr uint8_t maxTimebase = WWDG_CFR_WDGTB_Msk >> WWDG_CFR_WDGTB_Pos; /**< @brief Maximum WWDG prescaler as power of 2. */
+		static constexpr uint8_t ratioShift = 16; /**< @brief Fraction bits of WWDG ticks per ms. */
+		static constexpr uint8_t usShift = 16; /**< @brief Fraction bits of us per WWDG tick. */
+
+		// STRUCTS
+		/**
+		 * @brief Compile-time WWDG configuration.
+		 * 
+		 * Selects the smallest prescaler whose counter value fits in WWDG counter and calculates window value for minimum refresh time. Timeout is rounded to nearest WWDG tick and window opens at or before minimum refresh time.
+		 * 
+		 * @tparam timeout Required timeout in ms.
+		 * @tparam freq WWDG input clock frequency in Hz.
+		 * @tparam minTime Minimum refresh time in ms. \c 0 disables window.
+		 */
+		template<uint32_t timeout, uint32_t freq, uint32_t minTime = 0>
+		struct Config
+		{
+			static_assert(timeout > 0, "WWDG timeout must be greater than 0");
+			static_assert(minTime < timeout, "WWDG minimum refresh time must be lower than timeout");
+			static_assert(freq > 0, "WWDG input clock frequency must be greater than 0");
+
+			/**
+			 * @brief Find smallest prescaler for required timeout.
+			 * 
+			 * @param cycles Required timeout in PCLK cycles.
+			 * @return WWDG prescaler as power of 2.
+			 */
+			static constexpr uint8_t findTimebase(const uint64_t cycles)
+			{
+				uint8_t tb = 0;
+
+				// Find first prescaler that gives counter within range
+				while (tb < maxTimebase && ((cycles + ((tickCycles / 2) << tb)) >> (tickShift + tb)) > maxTicks)
+				{
+					tb++;
+				}
+
+				return tb;
+			}
+
+			static constexpr uint64_t cycles = ((uint64_t)timeout * freq + 500) / 1000; /**< @brief Required timeout in PCLK cycles. */
+			static constexpr uint8_t timebase = findTimebase(cycles); /**< @brief Selected WWDG prescaler as power of 2. */
+			static constexpr uint64_t counts = (cycles + ((tickCycles / 2) << timebase)) >> (tickShift + timebase); /**< @brief Number of prescaled WWDG ticks before reset. */
+			static constexpr uint64_t minCounts = (((uint64_t)minTime * freq) / 1000) >> (tickShift + timebase); /**< @brief Minimum refresh time in prescaled WWDG ticks. */
+
+			static_assert(counts >= 1, "WWDG timeout is too short for given input clock frequency");
+			static_assert(counts <= maxTicks, "WWDG timeout is too long for given input clock frequency");
+			static_assert(counts > minCounts, "WWDG refresh window is too narrow for given input clock frequency");
+
+			static constexpr uint8_t counter = (uint8_t)(resetCounter + counts); /**< @brief Selected counter value. */
+			static constexpr uint8_t window = minTime ? (uint8_t)(counter - minCounts) : counterMask; /**< @brief Selected window value. */
+			static constexpr uint32_t achievedUs = (uint32_t)(((counts << (tickShift + timebase)) * 1000000) / freq); /**< @brief Achieved timeout in us. */
+			static constexpr uint32_t resolutionUs = (uint32_t)(((1ULL << (tickShift + timebase)) * 1000000) / freq); /**< @brief Timeout step of selected prescaler in us. */
+		};
+
+		// VARIABLES
+		uint32_t ticksPerMs = (uint32_t)((16000000ULL << ratioShift) / (tickCycles * 1000)); /**< @brief WWDG ticks without prescaler per ms in fixed point. */
+		uint32_t usPerTick = (uint32_t)(((tickCycles * 1000000ULL) << usShift) / 16000000); /**< @brief us per WWDG tick without prescaler in fixed point. */
+		uint8_t counter = counterMask; /**< @brief WWDG counter reload value. */
+		uint8_t window = counterMask; /**< @brief WWDG window value. */
+
+		// METHOD DEFINITIONS
+		/**
+		 * @brief Calculate achieved timing for given configuration.
+		 * 
+		 * @param timebase WWDG prescaler as power of 2.
+		 * @param counts Number of prescaled WWDG ticks before reset.
+		 * @param clamped Required timeout was limited.
+		 * @return Achieved timeout and prescaler resolution.
+		 */
+		Timing_t calcTiming(const uint8_t timebase, const uint32_t counts, const bool clamped) const
+		{
+			return {
+				(uint32_t)((((uint64_t)counts << timebase) * usPerTick) >> usShift),
+				(uint32_t)(((1ULL << timebase) * usPerTick) >> usShift),
+				clamped
+			};
+		}
+
+		/**
+		 * @brief Write WWDG configuration.
+		 * 
+		 * @param timebase WWDG prescaler as power of 2.
+		 * @param newCounter New counter reload value.
+		 * @param newWindow New window value.
+		 * @return No return value.
+		 */
+		void setConfig(const uint8_t timebase, const uint8_t newCounter, const uint8_t newWindow)
+		{
+			counter = newCounter;
+			window = newWindow;
+
+			// Write prescaler and window value
+			R::write(WWDGReg_t::CFR, (R::read(WWDGReg_t::CFR) & ~(WWDG_CFR_WDGTB_Msk | counterMask)) | ((uint32_t)timebase << WWDG_CFR_WDGTB_Pos) | window);
+
+			// Reload counter if WWDG is already running
+			if (R::read(WWDGReg_t::CR) & WWDG_CR_WDGA)
+			{
+				feed();
+			}
+		}
+	};
+
+	using WWDGDriver = BasicWWDG<>; /**< @brief STM32 WWDG driver with memory-mapped registers of WWDG instance for this core. */
+
+#if defined(WWDG1_BASE) && defined(WWDG2_BASE)
+	using WWDG1Driver = BasicWWDG<WWDGMemory<WWDG1_BASE>>; /**< @brief WWDG1 driver. */
+	using WWDG2Driver = BasicWWDG<WWDGMemory<WWDG2_BASE>>; /**< @brief WWDG2 driver. */
+#endif // WWDG1_BASE && WWDG2_BASE
+
+	// CLASS FOR DUAL WATCHDOG
+	/**
+	 * @brief Coordinated IWDG and WWDG controller.
+	 * 
+	 * WWDG catches timing faults of fast loop and IWDG catches lockups and clock failures. Both watchdogs are fed from one \ref feed inside WWDG refresh window, so IWDG timeout has to be longer than WWDG timeout. Achieved timeouts after prescaler rounding are compared at compile time.
+	 * 
+	 * @tparam iwdgTimeout IWDG timeout in ms. Use maximum LSI frequency for \p lsi, so IWDG never expires before WWDG timeout.
+	 * @tparam wwdgTimeout WWDG timeout in ms.
+	 * @tparam pclk WWDG input clock (PCLK) frequency in Hz.
+	 * @tparam wwdgMinTime WWDG minimum refresh time in ms. Set to \c 0 to disable window.
+	 * @tparam lsi IWDG input clock frequency in Hz.
+	 * @tparam I IWDG driver class.
+	 * @tparam W WWDG driver class.
+	 */
+	template<uint32_t iwdgTimeout, uint32_t wwdgTimeout, uint32_t pclk, uint32_t wwdgMinTime = 0, uint32_t lsi = 32000, class I = IWDGDriver, class W = WWDGDriver>
+	class Dual : public SWDT<Dual<iwdgTimeout, wwdgTimeout, pclk, wwdgMinTime, lsi, I, W>>
+	{
+		static_assert(I::template getTiming<iwdgTimeout, lsi>().timeout > W::template getTiming<wwdgTimeout, pclk, wwdgMinTime>().timeout, "Achieved IWDG timeout must be longer than achieved WWDG timeout");
+
+		public:
+		Dual(void)
+		{
+
+		}
+
+		~Dual(void)
+		{
+
+		}
+
+
+		/**
+		 * @brief Configure and start both watchdogs.
+		 * 
+		 * @return No return value.
+		 */
+		void start(void)
+		{
+			iwdg.start();
+			iwdg.template configure<iwdgTimeout, lsi>();
+			wwdg.template configure<wwdgTimeout, pclk, wwdgMinTime>();
+			wwdg.start();
+		}
+
+		/**
+		 * @brief Feed both watchdogs if WWDG counter is inside refresh window.
+		 * 
+		 * WWDG counter is read first, so both register writes are issued back to back.
+		 * 
+		 * @return \c true if watchdogs are fed.
+		 * @return \c false if WWDG refresh window is not open yet.
+		 */
+		inline bool feed(void)
+		{
+			if (!wwdg.isInWindow())
+			{
+				return false;
+			}
+
+			iwdg.feed();
+			wwdg.feed();
+			return true;
+		}
+
+		void setTimeout(uint32_t timeout)
+		{
+			(void)timeout;
+			static_assert(sizeof(I) == 0, "Dual watchdog timeouts are fixed at compile time");
+		}
+
+		void setInputFreq(uint32_t value)
+		{
+			iwdg.setInputFreq(value);
+		}
+
+		/**
+		 * @brief Get IWDG driver.
+		 * 
+		 * @return Reference to IWDG driver.
+		 */
+		inline I& getIWDG(void)
+		{
+			return iwdg;
+		}
+
+		/**
+		 * @brief Get WWDG driver.
+		 * 
+		 * @return Reference to WWDG driver.
+		 */
+		inline W& getWWDG(void)
+		{
+			return wwdg;
+		}
+
+
+		private:
+		// VARIABLES
+		I iwdg; /**< @brief IWDG driver. */
+		W wwdg; /**< @brief WWDG driver. */
+	};
+
+	// CLASS FOR LINK-TIME CLIENTS
+	/**
+	 * @brief Supervisor client descriptor. Defined with \ref SWDT_CLIENT.
+	 * 
+	 */
+	struct Client_t
+	{
+		const char* name; /**< @brief Client name. */
+		uint8_t id; /**< @brief Supervisor channel ID. */
+		uint32_t period; /**< @brief Expected maximum check-in period in ms. */
+	};
+
+	// Section bounds generated by linker. Weak, so they resolve to null when no client is defined
+	extern "C" const Client_t __start_swdt_clients[] __attribute__((weak));
+	extern "C" const Client_t __stop_swdt_clients[] __attribute__((weak));
+
+	/**
+	 * @brief Clients registered with \ref SWDT_CLIENT.
+	 * 
+	 */
+	class Clients
+	{
+		public:
+		/**
+		 * @brief Get first client descriptor.
+		 * 
+		 * @return Pointer to first client descriptor.
+		 */
+		static inline const Client_t* begin(void)
+		{
+			return __start_swdt_clients;
+		}
+
+		/**
+		 * @brief Get end of client descriptors.
+		 * 
+		 * @return Pointer past last client descriptor.
+		 */
+		static inline const Client_t* end(void)
+		{
+			return __stop_swdt_clients;
+		}
+
+		/**
+		 * @brief Get number of clients.
+		 * 
+		 * @return Number of client descriptors in \c swdt_clients section.
+		 */
+		static inline uint32_t count(void)
+		{
+			return (uint32_t)(end() - begin());
+		}
+
+		/**
+		 * @brief Get client descriptor by channel ID.
+		 * 
+		 * @param id Supervisor channel ID.
+		 * @return Pointer to client descriptor.
+		 * @return \c nullptr if no client has given channel ID.
+		 */
+		static const Client_t* find(const uint8_t id)
+		{
+			for (const Client_t* client = begin(); client != end(); client++)
+			{
+				if (client->id == id)
+				{
+					return client;
+				}
+			}
+
+			return nullptr;
+		}
+	};
+
+	// CLASS FOR MULTI-TASK SUPERVISOR
+	/**
+	 * @brief Software watchdog supervisor.
+	 * 
+	 * Multiplexes up to 32 software channels onto one hardware watchdog. Each channel checks in with one lock-free bit-set and hardware watchdog is fed only when all registered channels checked in.
+	 * 
+	 * @tparam W Hardware watchdog class.
+	 * @tparam N Number of channels.
+	 */
+	template<class W, uint8_t N>
+	class Supervisor : public SWDT<Supervisor<W, N>>
+	{
+		static_assert(is_watchdog_v<W>, "Supervisor requires watchdog driver");
+		static_assert(N > 0 && N <= 32, "Supervisor supports 1 to 32 channels");
+
+		public:
+		static constexpr uint8_t channels = N; /**< @brief Number of channels. */
+
+		/**
+		 * @brief Supervisor constructor.
+		 * 
+		 * @param watchdog Reference to hardware watchdog.
+		 */
+		Supervisor(W& watchdog) : wdt(watchdog)
+		{
+#ifdef SRAM_BB_BASE
+			// Use bit-band alias for single store check-in if alive word is in bit-band region
+			const uintptr_t addr = (uintptr_t)&alive;
+			if (addr >= SRAM_BASE && addr < (SRAM_BASE + 0x100000))
+			{
+				aliveBitBand = (volatile uint32_t*)(SRAM_BB_BASE + ((addr - SRAM_BASE) << 5));
+			}
+#endif // SRAM_BB_BASE
+		}
+
+		~Supervisor(void)
+		{
+
+		}
+
+
+		void start(void) const
+		{
+			wdt.start();
+		}
+
+		/**
+		 * @brief Feed hardware watchdog if all registered channels checked in.
+		 * 
+		 * Check-in bits of registered channels are cleared after hardware watchdog is fed.
+		 * 
+		 * @return No return value.
+		 */
+		void feed(void)
+		{
+			const uint32_t mask = registered;
+
+			// Do not feed if any registered channel did not check in
+			if ((alive & mask) != mask)
+			{
+				return;
+			}
+
+			// Clear check-in bits and feed hardware watchdog
+			atomicAnd(alive, ~mask);
+			wdt.feed();
+		}
+
+		void setTimeout(uint32_t timeout)
+		{
+			wdt.setTimeout(timeout);
+		}
+
+		void setInputFreq(uint32_t value)
+		{
+			wdt.setInputFreq(value);
+		}
+
+		/**
+		 * @brief Register supervisor channel.
+		 * 
+		 * Channel is marked as checked in, so it has one full period to check in after registration.
+		 * 
+		 * @param channel Channel ID. Must be lower than \p N.
+		 * @return No return value.
+		 */
+		void registerChannel(const uint8_t channel)
+		{
+			atomicOr(alive, 1UL << channel);
+			atomicOr(registered, 1UL << channel);
+		}
+
+		/**
+		 * @brief Register all clients defined with \ref SWDT_CLIENT.
+		 * 
+		 * Call once at startup, before clients start to check in. Clients with channel ID out of range are skipped. Channels share supervisor feed period, so client check-in period is not used.
+		 * 
+		 * @return Number of registered clients.
+		 */
+		uint8_t registerClients(void)
+		{
+			uint32_t mask = 0;
+			uint8_t count = 0;
+
+			// Build channel mask once, so feed check stays one compare
+			for (const Client_t& client : Clients())
+			{
+				if (client.id < N)
+				{
+					mask |= 1UL << client.id;
+					count++;
+				}
+			}
+
+			atomicOr(alive, mask);
+			atomicOr(registered, mask);
+			return count;
+		}
+
+		/**
+		 * @brief Unregister supervisor channel.
+		 * 
+		 * @param channel Channel ID. Must be lower than \p N.
+		 * @return No return value.
+		 */
+		void unregisterChannel(const uint8_t channel)
+		{
+			atomicAnd(registered, ~(1UL << channel));
+		}
+
+		/**
+		 * @brief Check in supervisor channel. Safe to call from interrupts.
+		 * 
+		 * @param channel Channel ID. Must be lower than \p N.
+		 * @return No return value.
+		 */
+		inline void checkIn(const uint8_t channel)
+		{
+#ifdef SRAM_BB_BASE
+			if (aliveBitBand)
+			{
+				// Single store to bit-band alias
+				aliveBitBand[channel] = 1;
+				return;
+			}
+#endif // SRAM_BB_BASE
+
+			atomicOr(alive, 1UL << channel);
+		}
+
+		/**
+		 * @brief Get registered channels that did not check in since last feed.
+		 * 
+		 * @return Bit mask of missing channels.
+		 */
+		inline uint32_t getMissing(void) const
+		{
+			return registered & ~alive;
+		}
+
+
+		private:
+		// VARIABLES
+		W& wdt; /**< @brief Reference to hardware watchdog. */
+		volatile uint32_t alive = 0; /**< @brief Check-in bits. */
+		volatile uint32_t registered = 0; /**< @brief Registered channel bits. */
+#ifdef SRAM_BB_BASE
+		volatile uint32_t* aliveBitBand = nullptr; /**< @brief Bit-band alias of \ref alive. */
+#endif // SRAM_BB_BASE
+
+		// METHOD DEFINITIONS
+		/**
+		 * @brief Atomically set bits in word.
+		 * 
+		 * @param word Reference to word.
+		 * @param mask Bits to set.
+		 * @return No return value.
+		 */
+		static inline void atomicOr(volatile uint32_t& word, const uint32_t mask)
+		{
+#if (__CORTEX_M >= 3)
+			uint32_t value;
+			do
+			{
+				value = __LDREXW(&word) | mask;
+			}
+			while (__STREXW(value, &word));
+#else
+			const uint32_t primask = __get_PRIMASK();
+			__disable_irq();
+			word |= mask;
+			__set_PRIMASK(primask);
+#endif // __CORTEX_M
+		}
+
+		/**
+		 * @brief Atomically clear bits in word.
+		 * 
+		 * @param word Reference to word.
+		 * @param mask Bits to keep.
+		 * @return No return value.
+		 */
+		static inline void atomicAnd(volatile uint32_t& word, const uint32_t mask)
+		{
+#if (__CORTEX_M >= 3)
+			uint32_t value;
+			do
+			{
+				value = __LDREXW(&word) & mask;
+			}
+			while (__STREXW(value, &word));
+#else
+			const uint32_t primask = __get_PRIMASK();
+			__disable_irq();
+			word &= mask;
+			__set_PRIMASK(primask);
+#endif // __CORTEX_M
+		}
+	};
+
+	// CLASS FOR HEARTBEAT AGGREGATION
+	/**
+	 * @brief Remote node heartbeat aggregator on top of \ref Supervisor or \ref DeadlineSupervisor.
+	 * 
+	 * Each remote node maps to one supervisor channel, starting at \p first. Transport driver passes node ID and sequence number of each received heartbeat to \ref onHeartbeat, usually from receive interrupt, and hardware watchdog is fed only when every registered node and local channel checked in.
+	 * With \ref Supervisor, node deadline is shared supervisor feed period and heartbeat handling is one bit operation. With \ref DeadlineSupervisor, each node has its own deadline from \c Deadlines list at index <tt>first + node</tt> and heartbeat handling is one timestamp store.
+	 * 
+	 * @tparam S Supervisor class.
+	 * @tparam N Number of remote nodes.
+	 * @tparam first Supervisor channel of node \c 0. Channels \p first to <tt>first + N - 1</tt> must not be used by local channels.
+	 * @tparam Q Heartbeat sequence number type.
+	 */
+	template<class S, uint8_t N, uint8_t first = 0, class Q = uint8_t>
+	class HeartbeatAggregator : public SWDT<HeartbeatAggregator<S, N, first, Q>>
+	{
+		static_assert(N > 0 && N <= 32, "HeartbeatAggregator supports 1 to 32 nodes");
+		static_assert((first + N) <= S::channels, "Node channels must fit in supervisor channels");
+		static_assert(std::is_unsigned_v<Q>, "Heartbeat sequence number must be unsigned integer");
+
+		public:
+		/**
+		 * @brief Heartbeat aggregator constructor.
+		 * 
+		 * @param supervisor Reference to supervisor.
+		 */
+		HeartbeatAggregator(S& supervisor) : sup(supervisor)
+		{
+
+		}
+
+		~HeartbeatAggregator(void)
+		{
+
+		}
+
+
+		void start(void)
+		{
+			sup.start();
+		}
+
+		inline void feed(void)
+		{
+			sup.feed();
+		}
+
+		void setTimeout(uint32_t timeout)
+		{
+			sup.setTimeout(timeout);
+		}
+
+		void setInputFreq(uint32_t value)
+		{
+			sup.setInputFreq(value);
+		}
+
+		/**
+		 * @brief Start supervising remote node.
+		 * 
+		 * First heartbeat after registration is accepted with any sequence number.
+		 * 
+		 * @param node Node ID. Must be lower than \p N.
+		 * @return No return value.
+		 */
+		void registerNode(const uint8_t node)
+		{
+			fresh[node] = true;
+			sup.registerChannel(first + node);
+		}
+
+		/**
+		 * @brief Stop supervising remote node.
+		 * 
+		 * @param node Node ID. Must be lower than \p N.
+		 * @return No return value.
+		 */
+		void unregisterNode(const uint8_t node)
+		{
+			sup.unregisterChannel(first + node);
+		}
+
+		/**
+		 * @brief Handle received heartbeat. Safe to call from interrupts.
+		 * 
+		 * Heartbeat with same sequence number as previous one of same node is rejected, so stuck transmitter or duplicated frame does not keep node alive. First heartbeat after \ref registerNode is always accepted.
+		 * 
+		 * @param node Node ID.
+		 * @param seq Heartbeat sequence number.
+		 * @return \c true if heartbeat is accepted.
+		 * @return \c false if node ID is out of range or heartbeat is repeated.
+		 */
+		inline bool onHeartbeat(const uint8_t node, const Q seq)
+		{
+			if (node >= N || (seq == lastSeq[node] && !fresh[node]))
+			{
+				return false;
+			}
+
+			lastSeq[node] = seq;
+			fresh[node] = false;
+			sup.checkIn(first + node);
+			return true;
+		}
+
+		/**
+		 * @brief Get registered nodes that did not send heartbeat since last feed.
+		 * 
+		 * @return Bit mask of missing nodes.
+		 */
+		inline uint32_t getMissing(void) const
+		{
+			return (sup.getMissing() >> first) & nodeMask;
+		}
+
+
+		private:
+		// CONSTANTS
+		static constexpr uint32_t nodeMask = (uint32_t)((1ULL << N) - 1); /**< @brief Bit mask of all nodes. */
+
+		// VARIABLES
+		S& sup; /**< @brief Reference to supervisor. */
+		volatile Q lastSeq[N] = {}; /**< @brief Last accepted sequence number of each node. */
+		volatile bool fresh[N] = {}; /**< @brief Node is registered and did not send heartbeat yet. */
+	};
+
+	// CLASS FOR DEADLINE SUPERVISOR
+	/**
+	 * @brief Software watchdog supervisor with per-channel deadlines.
+	 * 
+	 * Each channel checks in with one timestamp store. Hardware watchdog is fed only when every registered channel checked in within its deadline. All channels are registered by default. Deadline check scans packed timestamp array in one pass without branches per channel, so it takes constant time.
+	 * Worst check-in interval is tracked per channel to tune deadlines.
+	 * 
+	 * @tparam W Hardware watchdog class.
+	 * @tparam Deadlines Channel deadlines in ms. Channel ID is index in the list.
+	 * @note \ref Clock::init has to be called before \ref start.
+	 */
+	template<class W, uint32_t... Deadlines>
+	class DeadlineSupervisor : public SWDT<DeadlineSupervisor<W, Deadlines...>>
+	{
+		static_assert(is_watchdog_v<W>, "DeadlineSupervisor requires watchdog driver");
+		static_assert(sizeof...(Deadlines) > 0 && sizeof...(Deadlines) <= 32, "DeadlineSupervisor supports 1 to 32 channels");
+		static_assert(((Deadlines > 0) && ...), "Channel deadline must be greater than 0");
+
+		public:
+		static constexpr uint8_t channels = sizeof...(Deadlines); /**< @brief Number of channels. */
+
+		/**
+		 * @brief Deadline supervisor constructor.
+		 * 
+		 * @param watchdog Reference to hardware watchdog.
+		 */
+		DeadlineSupervisor(W& watchdog) : wdt(watchdog)
+		{
+
+		}
+
+		~DeadlineSupervisor(void)
+		{
+
+		}
+
+
+		/**
+		 * @brief Convert deadlines to \ref Clock units, check in all channels and start hardware watchdog.
+		 * 
+		 * @return No return value.
+		 */
+		void start(void)
+		{
+			const uint32_t now = Clock::now();
+
+			for (uint8_t i = 0; i < channels; i++)
+			{
+				limit[i] = Clock::fromMs(deadlines[i]);
+				stamp[i] = now;
+				worst[i] = 0;
+			}
+
+			wdt.start();
+		}
+
+		/**
+		 * @brief Feed hardware watchdog if all channels are within their deadlines.
+		 * 
+		 * @return No return value.
+		 */
+		void feed(void)
+		{
+			const uint32_t now = Clock::now();
+			uint32_t late = 0;
+
+			// Collect late channels without branching per channel
+			for (uint8_t i = 0; i < channels; i++)
+			{
+				late |= (uint32_t)((now - stamp[i]) > limit[i]) << i;
+			}
+
+			if (late & registered)
+			{
+				return;
+			}
+
+			wdt.feed();
+		}
+
+		void setTimeout(uint32_t timeout)
+		{
+			wdt.setTimeout(timeout);
+		}
+
+		void setInputFreq(uint32_t value)
+		{
+			wdt.setInputFreq(value);
+		}
+
+		/**
+		 * @brief Check in channel. Safe to call from interrupts.
+		 * 
+		 * @param channel Channel ID. Must be lower than \ref channels.
+		 * @return No return value.
+		 */
+		inline void checkIn(const uint8_t channel)
+		{
+			const uint32_t now = Clock::now();
+			const uint32_t interval = now - stamp[channel];
+
+			if (interval > worst[channel])
+			{
+				worst[channel] = interval;
+			}
+
+			stamp[channel] = now;
+		}
+
+		/**
+		 * @brief Register channel.
+		 * 
+		 * Channel is checked in, so it has full deadline after registration. Call from one context only.
+		 * 
+		 * @param channel Channel ID. Must be lower than \ref channels.
+		 * @return No return value.
+		 */
+		void registerChannel(const uint8_t channel)
+		{
+			stamp[channel] = Clock::now();
+			registered |= 1UL << channel;
+		}
+
+		/**
+		 * @brief Unregister channel. Late unregistered channel does not block feed.
+		 * 
+		 * Call from one context only.
+		 * 
+		 * @param channel Channel ID. Must be lower than \ref channels.
+		 * @return No return value.
+		 */
+		void unregisterChannel(const uint8_t channel)
+		{
+			registered &= ~(1UL << channel);
+		}
+
+		/**
+		 * @brief Register all clients defined with \ref SWDT_CLIENT.
+		 * 
+		 * Client check-in period replaces deadline of its channel, period \c 0 keeps deadline from \p Deadlines list. Call once after \ref start, before clients start to check in, because \ref start restores deadlines from \p Deadlines list. Clients with channel ID out of range are skipped. Call from one context only.
+		 * 
+		 * @return Number of registered clients.
+		 */
+		uint8_t registerClients(void)
+		{
+			const uint32_t now = Clock::now();
+			uint8_t count = 0;
+
+			for (const Client_t& client : Clients())
+			{
+				if (client.id < channels)
+				{
+					if (client.period)
+					{
+						limit[client.id] = Clock::fromMs(client.period);
+					}
+					stamp[client.id] = now;
+					registered |= 1UL << client.id;
+					count++;
+				}
+			}
+
+			return count;
+		}
+
+		/**
+		 * @brief Get registered late channels.
+		 * 
+		 * @return Bit mask of registered channels that missed their deadline.
+		 */
+		inline uint32_t getMissing(void) const
+		{
+			return getLate() & registered;
+		}
+
+		/**
+		 * @brief Get late channels.
+		 * 
+		 * @return Bit mask of channels that missed their deadline.
+		 */
+		uint32_t getLate(void) const
+		{
+			const uint32_t now = Clock::now();
+			uint32_t late = 0;
+
+			for (uint8_t i = 0; i < channels; i++)
+			{
+				late |= (uint32_t)((now - stamp[i]) > limit[i]) << i;
+			}
+
+			return late;
+		}
+
+		/**
+		 * @brief Get worst check-in interval of channel since \ref start or \ref clearWorst.
+		 * 
+		 * @param channel Channel ID. Must be lower than \ref channels.
+		 * @return Worst check-in interval in \ref Clock units.
+		 */
+		inline uint32_t getWorst(const uint8_t channel) const
+		{
+			return worst[channel];
+		}
+
+		/**
+		 * @brief Clear worst check-in intervals.
+		 * 
+		 * @return No return value.
+		 */
+		void clearWorst(void)
+		{
+			for (uint8_t i = 0; i < channels; i++)
+			{
+				worst[i] = 0;
+			}
+		}
+
+
+		private:
+		// CONSTANTS
+		static constexpr uint32_t deadlines[channels] = { Deadlines... }; /**< @brief Channel deadlines in ms. */
+
+		// VARIABLES
+		W& wdt; /**< @brief Reference to hardware watchdog. */
+		uint32_t limit[channels] = {}; /**< @brief Channel deadlines in \ref Clock units. */
+		volatile uint32_t stamp[channels] = {}; /**< @brief Timestamps of last check-in. */
+		volatile uint32_t worst[channels] = {}; /**< @brief Worst check-in intervals in \ref Clock units. */
+		volatile uint32_t registered = (uint32_t)((1ULL << channels) - 1); /**< @brief Registered channel bits. */
+	};
+
+#if defined(LPTIM_CR_ENABLE) && defined(LPTIM_IER_ARRMIE)
+	// CLASS FOR PRE-TIMEOUT WARNING
+	/**
+	 * @brief Pre-timeout warning for watchdogs without early wakeup interrupt.
+	 * 
+	 * LPTIM period is set to \c percent of achieved watchdog timeout. On each LPTIM period interrupt, \p Hook is called if watchdog was not fed during that period, so \p Hook is called between one and two periods after last feed.
+	 * Period is limited so two periods end at 3/4 of shortest real timeout for watchdog clock running \p tolerance percents faster than its nominal frequency. This leaves last quarter of timeout for \p Hook.
+	 * Feed costs one store on top of watchdog feed. LPTIM clock source has to be selected and enabled in RCC before \ref setTimeout or \ref arm.
+	 * 
+	 * @tparam W Hardware watchdog class.
+	 * @tparam Hook Pre-timeout callback. Called from LPTIM interrupt.
+	 * @tparam tolerance Watchdog input clock tolerance in percents. Default covers LSI running up to 50 % faster. Use lower value after \ref BasicIWDG::calibrate.
+	 */
+	template<class W, void (*Hook)(void), uint8_t tolerance = 50>
+	class PreTimeout : public SWDT<PreTimeout<W, Hook, tolerance>>
+	{
+		static_assert(is_watchdog_v<W>, "PreTimeout requires watchdog driver");
+
+		public:
+		/**
+		 * @brief Pre-timeout warning constructor.
+		 * 
+		 * @param watchdog Reference to hardware watchdog.
+		 * @param timer Pointer to LPTIM peripheral.
+		 * @param timerFreq LPTIM input clock frequency in Hz.
+		 * @param percent LPTIM period in percents of watchdog timeout. Limited to range from 1 % to limit set by \p tolerance, 25 % for default tolerance.
+		 */
+		PreTimeout(W& watchdog, LPTIM_TypeDef* timer, const uint32_t timerFreq, const uint8_t percent = maxPercent) : wdt(watchdog), timer(timer), timerFreq(timerFreq), percent((percent > maxPercent) ? maxPercent : (percent ? percent : 1))
+		{
+
+		}
+
+		~PreTimeout(void)
+		{
+
+		}
+
+
+		void start(void)
+		{
+			fed = true;
+			wdt.start();
+		}
+
+		inline void feed(void)
+		{
+			wdt.feed();
+			fed = true;
+		}
+
+		/**
+		 * @brief Set watchdog timeout and arm LPTIM for achieved timeout.
+		 * 
+		 * @param timeout Required watchdog timeout in ms.
+		 * @return \ref Status_t::Done if LPTIM is running.
+		 * @return \ref Status_t::Timeout if watchdog or LPTIM did not accept new configuration within \ref SWDT_TIMEOUT. LPTIM is not armed if watchdog configuration failed.
+		 */
+		Status_t setTimeout(uint32_t timeout)
+		{
+			const Timing_t timing = wdt.setTimeout(timeout);
+			if (timing.status != Status_t::Done)
+			{
+				return timing.status;
+			}
+
+			return arm(timing);
+		}
+
+		void setInputFreq(uint32_t value)
+		{
+			wdt.setInputFreq(value);
+		}
+
+		/**
+		 * @brief Arm LPTIM for programmed watchdog timeout. Use when watchdog is configured directly.
+		 * 
+		 * @param timing Achieved watchdog timing, for example from \ref BasicIWDG::getTiming.
+		 * @return \ref Status_t::Done if LPTIM is running.
+		 * @return \ref Status_t::Timeout if LPTIM did not accept new period within \ref SWDT_TIMEOUT.
+		 */
+		Status_t arm(const Timing_t& timing)
+		{
+			// LPTIM period in LPTIM input clock ticks
+			const uint64_t ticks = ((uint64_t)timing.timeout * percent * timerFreq) / 100000000;
+
+			// Find first prescaler that gives period within ARR range
+			uint8_t presc = 0;
+			while (presc < maxPresc && (ticks >> presc) > (maxPeriod + 1ULL))
+			{
+				presc++;
+			}
+
+			uint32_t period = (uint32_t)(ticks >> presc);
+			if (period > (maxPeriod + 1UL))
+			{
+				period = maxPeriod + 1UL;
+			}
+			else if (period < 2)
+			{
+				// ARR must be greater than CMP
+				period = 2;
+			}
+
+			// Interrupt and prescaler can be configured only while LPTIM is disabled
+			timer->CR = 0;
+			timer->IER = LPTIM_IER_ARRMIE;
+			timer->CFGR = (uint32_t)presc << LPTIM_CFGR_PRESC_Pos;
+			timer->CR = LPTIM_CR_ENABLE;
+
+			// Write period and wait until LPTIM accepts it
+			timer->ICR = LPTIM_ICR_ARROKCF;
+			timer->ARR = period - 1;
+			const uint32_t start = SWDT_GET_TICK();
+			while (!(timer->ISR & LPTIM_ISR_ARROK))
+			{
+				if ((SWDT_GET_TICK() - start) >= SWDT_TIMEOUT)
+				{
+					timer->CR = 0;
+					return Status_t::Timeout;
+				}
+			}
+			timer->ICR = LPTIM_ICR_ARROKCF;
+
+			// Start continuous counting
+			fed = true;
+			timer->CR = LPTIM_CR_ENABLE | LPTIM_CR_CNTSTRT;
+
+			return Status_t::Done;
+		}
+
+		/**
+		 * @brief Stop LPTIM. Watchdog keeps running.
+		 * 
+		 * @return No return value.
+		 */
+		void stop(void)
+		{
+			timer->CR = 0;
+		}
+
+		/**
+		 * @brief Enable LPTIM interrupt in NVIC.
+		 * 
+		 * @param irq LPTIM interrupt number.
+		 * @param priority LPTIM interrupt priority.
+		 * @return No return value.
+		 */
+		void enableIRQ(const IRQn_Type irq, const uint32_t priority = 0) const
+		{
+			NVIC_SetPriority(irq, priority);
+			NVIC_EnableIRQ(irq);
+		}
+
+		/**
+		 * @brief Handle LPTIM interrupt. Call from LPTIM interrupt handler.
+		 * 
+		 * @return No return value.
+		 */
+		inline __attribute__((always_inline)) void handleIRQ(void)
+		{
+			// Clear period match flag
+			timer->ICR = LPTIM_ICR_ARRMCF;
+
+			// Warn if watchdog was not fed during last period
+			if (!fed)
+			{
+				Hook();
+			}
+			fed = false;
+		}
+
+
+		private:
+		// CONSTANTS
+		static constexpr uint8_t maxPercent = 3750 / (100 + tolerance); /**< @brief Maximum LPTIM period in percents of watchdog timeout. Two periods end at 3/4 of shortest real timeout. */
+		static constexpr uint8_t maxPresc = 7; /**< @brief Maximum LPTIM prescaler as power of 2. */
+		static constexpr uint16_t maxPeriod = 0xFFFF; /**< @brief Maximum LPTIM ARR value. */
+
+		// VARIABLES
+		W& wdt; /**< @brief Reference to hardware watchdog. */
+		LPTIM_TypeDef* timer = nullptr; /**< @brief Pointer to LPTIM peripheral. */
+		uint32_t timerFreq = 32000; /**< @brief LPTIM input clock frequency. */
+		uint8_t percent = maxPercent; /**< @brief LPTIM period in percents of watchdog timeout. */
+		volatile bool fed = true; /**< @brief Watchdog was fed during current LPTIM period. */
+	};
+#endif // LPTIM_CR_ENABLE && LPTIM_IER_ARRMIE
+
+	// CLASS FOR RTOS INTEGRATION
+	/**
+	 * @brief RTOS adapter for \ref Supervisor.
+	 * 
+	 * Hardware watchdog is fed only from lowest priority context, so feed proves that scheduler is not starved. Tasks check in with \ref Supervisor::checkIn, which is one atomic bit-set and never blocks or wakes any task.
+	 * Tick context only marks feed as due, so idle loop does not access supervisor on every pass.
+	 * 
+	 * FreeRTOS: define \c SWDT_RTOS_FREERTOS and use \ref SWDT_FREERTOS_HOOKS. \n
+	 * Zephyr: define \c SWDT_RTOS_ZEPHYR and use \ref SWDT_ZEPHYR_THREAD. \n
+	 * ThreadX: define \c SWDT_RTOS_THREADX and create lowest priority thread with \ref threadEntry.
+	 * 
+	 * @tparam S Supervisor class.
+	 */
+	template<class S>
+	class RTOSFeed
+	{
+		public:
+		/**
+		 * @brief RTOS adapter constructor.
+		 * 
+		 * @param supervisor Reference to supervisor.
+		 * @param channel Supervisor channel of idle context. Channel is registered in constructor.
+		 * @param period Feed period in RTOS ticks. Must be shorter than hardware watchdog timeout.
+		 */
+		RTOSFeed(S& supervisor, const uint8_t channel, const uint32_t period) : sup(supervisor), idleChannel(channel), feedPeriod(period)
+		{
+			sup.registerChannel(idleChannel);
+		}
+
+		~RTOSFeed(void)
+		{
+
+		}
+
+
+		/**
+		 * @brief Count RTOS tick. Call from RTOS tick hook.
+		 * 
+		 * @return No return value.
+		 */
+		inline void tick(void)
+		{
+			if (++ticks < feedPeriod)
+			{
+				return;
+			}
+
+			ticks = 0;
+			due = true;
+		}
+
+		/**
+		 * @brief Feed supervisor if feed is due. Call from RTOS idle hook.
+		 * 
+		 * @return No return value.
+		 */
+		inline void idle(void)
+		{
+			if (!due)
+			{
+				return;
+			}
+
+			due = false;
+			kick();
+		}
+
+#if defined(SWDT_RTOS_ZEPHYR) || defined(SWDT_RTOS_THREADX)
+		/**
+		 * @brief Feed loop for lowest priority thread. Used on RTOSes without idle hook.
+		 * 
+		 * Thread sleeps for feed period between feeds, so it wakes only once per period and only when no other thread is ready.
+		 * 
+		 * @return No return value.
+		 */
+		[[noreturn]] void run(void)
+		{
+			for (;;)
+			{
+				kick();
+#if defined(SWDT_RTOS_ZEPHYR)
+				k_sleep(K_TICKS(feedPeriod));
+#else
+				tx_thread_sleep(feedPeriod);
+#endif // SWDT_RTOS_ZEPHYR
+			}
+		}
+#endif // SWDT_RTOS_ZEPHYR || SWDT_RTOS_THREADX
+
+#if defined(SWDT_RTOS_THREADX)
+		/**
+		 * @brief ThreadX thread entry. Pass adapter address as thread input.
+		 * 
+		 * @param input Address of \ref RTOSFeed object.
+		 * @return No return value.
+		 */
+		static void threadEntry(ULONG input)
+		{
+			((RTOSFeed*)(uintptr_t)input)->run();
+		}
+#endif // SWDT_RTOS_THREADX
+
+
+		private:
+		// VARIABLES
+		S& sup; /**< @brief Reference to supervisor. */
+		const uint8_t idleChannel; /**< @brief Supervisor channel of idle context. */
+		const uint32_t feedPeriod; /**< @brief Feed period in RTOS ticks. */
+		uint32_t ticks = 0; /**< @brief RTOS ticks since last due feed. */
+		volatile bool due = false; /**< @brief Feed is due. */
+
+		// METHOD DEFINITIONS
+		/**
+		 * @brief Check in idle channel and feed supervisor.
+		 * 
+		 * @return No return value.
+		 */
+		inline void kick(void)
+		{
+			sup.checkIn(idleChannel);
+			sup.feed();
+		}
+	};
+
+	// CLASS FOR RESET CAUSE
+	/**
+	 * @brief Watchdog reset cause.
+	 * 
+	 */
+	class Reset
+	{
+		public:
+		// ENUMS
+		/**
+		 * @brief Watchdog reset cause flags.
+		 * 
+		 */
+		enum Cause_t : uint8_t {
+			None = 0, /**< @brief Last reset was not caused by watchdog. */
+			IWDGReset = 1 << 0, /**< @brief Last reset was caused by IWDG. */
+			WWDGReset = 1 << 1 /**< @brief Last reset was caused by WWDG. */
+		};
+
+		/**
+		 * @brief Get watchdog reset cause from RCC reset flags.
+		 * 
+		 * On dual-core STM32H7 IWDG1 and WWDG1 flags are checked on CM7 core and IWDG2 and WWDG2 flags on CM4 core.
+		 * 
+		 * @return Watchdog reset cause flags.
+		 */
+		static uint8_t getCause(void)
+		{
+			uint8_t cause = None;
+
+#if defined(RCC_RSR_IWDG2RSTF) && defined(CORE_CM4)
+			// CM4 core of dual-core H7 is reset by IWDG2 and WWDG2
+			if (RCC->RSR & RCC_RSR_IWDG2RSTF)
+			{
+				cause |= IWDGReset;
+			}
+
+			if (RCC->RSR & RCC_RSR_WWDG2RSTF)
+			{
+				cause |= WWDGReset;
+			}
+#elif defined(RCC_RSR_IWDG1RSTF)
+			if (RCC->RSR & RCC_RSR_IWDG1RSTF)
+			{
+				cause |= IWDGReset;
+			}
+
+			if (RCC->RSR & RCC_RSR_WWDG1RSTF)
+			{
+				cause |= WWDGReset;
+			}
+#else
+			if (RCC->CSR & RCC_CSR_IWDGRSTF)
+			{
+				cause |= IWDGReset;
+			}
+
+			if (RCC->CSR & RCC_CSR_WWDGRSTF)
+			{
+				cause |= WWDGReset;
+			}
+#endif // RCC_RSR_IWDG1RSTF
+
+			return cause;
+		}
+
+		/**
+		 * @brief Clear all RCC reset flags.
+		 * 
+		 * @return No return value.
+		 */
+		static void clear(void)
+		{
+#if defined(RCC_RSR_RMVF)
+			RCC->RSR |= RCC_RSR_RMVF;
+#else
+			RCC->CSR |= RCC_CSR_RMVF;
+#endif // RCC_RSR_RMVF
+		}
+	};
+
+	// Debug is left out on families with unknown DBGMCU stop bits, core drivers do not depend on it
+#if defined(DBGMCU) && (defined(DBGMCU_APB1_FZ_DBG_IWDG_STOP) || defined(DBGMCU_CR_DBG_IWDG_STOP) || defined(DBGMCU_APB1FZR1_DBG_IWDG_STOP) || defined(DBGMCU_APB_FZ1_DBG_IWDG_STOP) || defined(DBGMCU_APB4FZ1_DBG_IWDG1))
+	// CLASS FOR DEBUG FREEZE
+	/**
+	 * @brief Watchdog freeze while core is halted by debugger.
+	 * 
+	 * Sets family specific DBGMCU stop bits, for example \c DBG_IWDG_STOP and \c DBG_WWDG_STOP in \c APB1FZ on F0/F4/F7/L0, \c CR on F1, \c APB1FZR1 on L4/G4/U5, \c APBFZ1 on G0 and \c APB4FZ1 / \c APB3FZ1 on H7.
+	 */
+	class Debug
+	{
+		public:
+		/**
+		 * @brief Apply \ref SWDT_DEBUG_FREEZE and check freeze state. Call at startup before watchdogs are started.
+		 * 
+		 * @return \c true if no debugger is attached or both watchdogs are frozen while core is halted.
+		 * @return \c false if debugger is attached and halting core would trigger watchdog reset.
+		 */
+		static bool init(void)
+		{
+#if SWDT_DEBUG_FREEZE
+			freeze(true);
+#endif // SWDT_DEBUG_FREEZE
+
+			return !isDebuggerAttached() || (isFrozen(true) && isFrozen(false));
+		}
+
+		/**
+		 * @brief Freeze or unfreeze watchdogs while core is halted.
+		 * 
+		 * @param enable Set to \c true to freeze watchdogs.
+		 * @param iwdg Include IWDG.
+		 * @param wwdg Include WWDG.
+		 * @return No return value.
+		 */
+		static void freeze(const bool enable, const bool iwdg = true, const bool wwdg = true)
+		{
+			// DBGMCU clock is gated on some families
+#if defined(RCC_APB2ENR_DBGMCUEN)
+			RCC->APB2ENR |= RCC_APB2ENR_DBGMCUEN;
+#elif defined(RCC_APB2ENR_DBGEN)
+			RCC->APB2ENR |= RCC_APB2ENR_DBGEN;
+#elif defined(RCC_APBENR1_DBGEN)
+			RCC->APBENR1 |= RCC_APBENR1_DBGEN;
+#endif // RCC_APB2ENR_DBGMCUEN
+
+			if (iwdg)
+			{
+				update(iwdgReg(), iwdgStop, enable);
+			}
+
+			if (wwdg)
+			{
+				update(wwdgReg(), wwdgStop, enable);
+			}
+		}
+
+		/**
+		 * @brief Check if watchdog is frozen while core is halted.
+		 * 
+		 * @param iwdg Set to \c true to check IWDG or \c false to check WWDG.
+		 * @return \c true if watchdog is frozen.
+		 * @return \c false otherwise.
+		 */
+		static bool isFrozen(const bool iwdg)
+		{
+			return iwdg ? (iwdgReg() & iwdgStop) : (wwdgReg() & wwdgStop);
+		}
+
+		/**
+		 * @brief Check if debugger is attached.
+		 * 
+		 * @return \c true if debugger is attached or core cannot detect it.
+		 * @return \c false if no debugger is attached.
+		 */
+		static bool isDebuggerAttached(void)
+		{
+#if (__CORTEX_M >= 3) && defined(CoreDebug_DHCSR_C_DEBUGEN_Msk)
+			return CoreDebug->DHCSR & CoreDebug_DHCSR_C_DEBUGEN_Msk;
+#else
+			// ARMv6-M cores cannot read DHCSR
+			return true;
+#endif // __CORTEX_M
+		}
+
+
+		private:
+		// CONSTANTS
+#if defined(DBGMCU_APB1_FZ_DBG_IWDG_STOP)
+		static constexpr uint32_t iwdgStop = DBGMCU_APB1_FZ_DBG_IWDG_STOP; /**< @brief IWDG stop bit. */
+		static constexpr uint32_t wwdgStop = DBGMCU_APB1_FZ_DBG_WWDG_STOP; /**< @brief WWDG stop bit. */
+#elif defined(DBGMCU_CR_DBG_IWDG_STOP)
+		static constexpr uint32_t iwdgStop = DBGMCU_CR_DBG_IWDG_STOP; /**< @brief IWDG stop bit. */
+		static constexpr uint32_t wwdgStop = DBGMCU_CR_DBG_WWDG_STOP; /**< @brief WWDG stop bit. */
+#elif defined(DBGMCU_APB1FZR1_DBG_IWDG_STOP)
+		static constexpr uint32_t iwdgStop = DBGMCU_APB1FZR1_DBG_IWDG_STOP; /**< @brief IWDG stop bit. */
+		static constexpr uint32_t wwdgStop = DBGMCU_APB1FZR1_DBG_WWDG_STOP; /**< @brief WWDG stop bit. */
+#elif defined(DBGMCU_APB_FZ1_DBG_IWDG_STOP)
+		static constexpr uint32_t iwdgStop = DBGMCU_APB_FZ1_DBG_IWDG_STOP; /**< @brief IWDG stop bit. */
+		static constexpr uint32_t wwdgStop = DBGMCU_APB_FZ1_DBG_WWDG_STOP; /**< @brief WWDG stop bit. */
+#elif defined(DBGMCU_APB4FZ1_DBG_IWDG1) && defined(CORE_CM4)
+		static constexpr uint32_t iwdgStop = DBGMCU_APB4FZ1_DBG_IWDG2; /**< @brief IWDG2 stop bit. */
+		static constexpr uint32_t wwdgStop = DBGMCU_APB1LFZ1_DBG_WWDG2; /**< @brief WWDG2 stop bit. */
+#elif defined(DBGMCU_APB4FZ1_DBG_IWDG1)
+		static constexpr uint32_t iwdgStop = DBGMCU_APB4FZ1_DBG_IWDG1; /**< @brief IWDG1 stop bit. */
+		static constexpr uint32_t wwdgStop = DBGMCU_APB3FZ1_DBG_WWDG1; /**< @brief WWDG1 stop bit. */
+#endif // DBGMCU_APB1_FZ_DBG_IWDG_STOP
+
+		// METHOD DEFINITIONS
+		/**
+		 * @brief Get DBGMCU register with IWDG stop bit.
+		 * 
+		 * @return Reference to register.
+		 */
+		static inline volatile uint32_t& iwdgReg(void)
+		{
+#if defined(DBGMCU_APB1_FZ_DBG_IWDG_STOP)
+			return DBGMCU->APB1FZ;
+#elif defined(DBGMCU_CR_DBG_IWDG_STOP)
+			return DBGMCU->CR;
+#elif defined(DBGMCU_APB1FZR1_DBG_IWDG_STOP)
+			return DBGMCU->APB1FZR1;
+#elif defined(DBGMCU_APB_FZ1_DBG_IWDG_STOP)
+			return DBGMCU->APBFZ1;
+#else
+			return DBGMCU->APB4FZ1;
+#endif // DBGMCU_APB1_FZ_DBG_IWDG_STOP
+		}
+
+		/**
+		 * @brief Get DBGMCU register with WWDG stop bit.
+		 * 
+		 * @return Reference to register.
+		 */
+		static inline volatile uint32_t& wwdgReg(void)
+		{
+#if defined(DBGMCU_APB1_FZ_DBG_IWDG_STOP)
+			return DBGMCU->APB1FZ;
+#elif defined(DBGMCU_CR_DBG_IWDG_STOP)
+			return DBGMCU->CR;
+#elif defined(DBGMCU_APB1FZR1_DBG_IWDG_STOP)
+			return DBGMCU->APB1FZR1;
+#elif defined(DBGMCU_APB_FZ1_DBG_IWDG_STOP)
+			return DBGMCU->APBFZ1;
+#elif defined(CORE_CM4)
+			return DBGMCU->APB1LFZ1;
+#else
+			return DBGMCU->APB3FZ1;
+#endif // DBGMCU_APB1_FZ_DBG_IWDG_STOP
+		}
+
+		/**
+		 * @brief Set or clear bit in register.
+		 * 
+		 * @param reg Reference to register.
+		 * @param bit Bit mask.
+		 * @param set Set to \c true to set bit.
+		 * @return No return value.
+		 */
+		static inline void update(volatile uint32_t& reg, const uint32_t bit, const bool set)
+		{
+			if (set)
+			{
+				reg |= bit;
+			}
+			else
+			{
+				reg &= ~bit;
+			}
+		}
+	};
+#endif // DBGMCU && DBGMCU_APB1_FZ_DBG_IWDG_STOP
+
+	// STRUCTS
+	/**
+	 * @brief Feed trace entry.
+	 * 
+	 */
+	struct TraceEntry_t
+	{
+		uint32_t timestamp; /**< @brief Feed timestamp in \ref Clock units. */
+		uint32_t site; /**< @brief Feed site ID. */
+	};
+
+	/**
+	 * @brief Feed trace ring buffer. Place it in retained RAM with \ref SWDT_NOINIT.
+	 * 
+	 * @tparam N Number of entries. Must be power of 2.
+	 */
+	template<uint8_t N>
+	struct TraceLog_t
+	{
+		static_assert(N && !(N & (N - 1)), "Trace log size must be power of 2");
+
+		uint32_t magic; /**< @brief Valid log marker. */
+		uint32_t freq; /**< @brief Timestamp frequency in Hz. */
+		uint32_t index; /**< @brief Number of recorded feeds. */
+		TraceEntry_t entries[N]; /**< @brief Ring buffer entries. */
+	};
+
+	// CLASS FOR FEED TRACE
+	/**
+	 * @brief Feed trace. Records site ID and timestamp of each feed into retained RAM ring buffer.
+	 * 
+	 * @tparam W Watchdog class.
+	 * @tparam N Number of log entries.
+	 */
+	template<class W, uint8_t N>
+	class Trace : public SWDT<Trace<W, N>>
+	{
+		static_assert(is_watchdog_v<W>, "Trace requires watchdog driver");
+
+		public:
+		/**
+		 * @brief Feed trace constructor.
+		 * 
+		 * @param watchdog Reference to watchdog.
+		 * @param traceLog Reference to ring buffer in retained RAM. Log content is preserved.
+		 */
+		Trace(W& watchdog, TraceLog_t<N>& traceLog) : wdt(watchdog), log(traceLog)
+		{
+
+		}
+
+		~Trace(void)
+		{
+
+		}
+
+
+		void start(void)
+		{
+			wdt.start();
+		}
+
+		/**
+		 * @brief Record feed site and feed watchdog.
+		 * 
+		 * @param site Feed site ID.
+		 * @return No return value.
+		 */
+		inline void feed(const uint32_t site = 0)
+		{
+			TraceEntry_t& entry = log.entries[log.index++ & (N - 1)];
+			entry.timestamp = Clock::now();
+			entry.site = site;
+
+			wdt.feed();
+		}
+
+		void setTimeout(uint32_t timeout)
+		{
+			wdt.setTimeout(timeout);
+		}
+
+		void setInputFreq(uint32_t value)
+		{
+			wdt.setInputFreq(value);
+		}
+
+		/**
+		 * @brief Check if retained log is valid.
+		 * 
+		 * @return \c true if log was written before last reset.
+		 * @return \c false if log content is random, for example after power-on reset.
+		 */
+		inline bool isValid(void) const
+		{
+			return log.magic == logMagic;
+		}
+
+		/**
+		 * @brief Call \p callback for each recorded feed, from oldest to newest.
+		 * 
+		 * @tparam F Callback type, <tt>void callback(const TraceEntry_t& entry)</tt>.
+		 * @param callback Callback.
+		 * @return Number of reported entries. \c 0 if log is not valid.
+		 */
+		template<class F>
+		uint8_t dump(F callback) const
+		{
+			if (!isValid())
+			{
+				return 0;
+			}
+
+			const uint32_t count = (log.index < N) ? log.index : N;
+			for (uint32_t i = log.index - count; i != log.index; i++)
+			{
+				callback(log.entries[i & (N - 1)]);
+			}
+
+			return (uint8_t)count;
+		}
+
+		/**
+		 * @brief Get timestamp frequency of recorded entries.
+		 * 
+		 * @return Timestamp frequency in Hz.
+		 */
+		inline uint32_t getFreq(void) const
+		{
+			return log.freq;
+		}
+
+		/**
+		 * @brief Clear log and mark it valid.
+		 * 
+		 * @return No return value.
+		 */
+		void clear(void)
+		{
+			log.index = 0;
+			log.freq = Clock::getFreq();
+			log.magic = logMagic;
+		}
+
+
+		private:
+		// CONSTANTS
+		static constexpr uint32_t logMagic = 0x53574454; /**< @brief Valid log marker. */
+
+		// VARIABLES
+		W& wdt; /**< @brief Reference to watchdog. */
+		TraceLog_t<N>& log; /**< @brief Reference to retained log. */
+	};
+
+#if defined(DMA_CCR_EN) || defined(DMA_SxCR_EN)
+	// CLASS FOR DMA FEED
+	/**
+	 * @brief Hardware feed. Timer update DMA request writes IWDG reload key, so CPU never writes IWDG registers.
+	 * 
+	 * DMA transfer count is feed permit. Each timer update consumes one permit and \ref feed re-arms permits, so IWDG resets MCU if \ref feed is not called within \c permits timer periods.
+	 * Timer update DMA request has to be routed to DMA channel (DMAMUX, CSELR or CHSEL) and timer clock has to be enabled before \ref start. Use it as hardware watchdog for \ref Supervisor to gate permits with channel check-ins.
+	 */
+	class DMAFeed : public SWDT<DMAFeed>
+	{
+		public:
+#if defined(DMA_CCR_EN)
+		typedef DMA_Channel_TypeDef DMA_t; /**< @brief DMA channel type. */
+#else
+		typedef DMA_Stream_TypeDef DMA_t; /**< @brief DMA stream type. */
+#endif // DMA_CCR_EN
+
+		/**
+		 * @brief DMA feed constructor.
+		 * 
+		 * @param dma Pointer to DMA channel or stream with timer update request.
+		 * @param timer Pointer to timer that triggers feed.
+		 * @param permits Number of feeds allowed after each \ref feed call.
+		 */
+#if defined(DMA_CCR_EN)
+		DMAFeed(DMA_t* dma, TIM_TypeDef* timer, const uint16_t permits = 2) : dma(dma), timer(timer), permits(permits)
+#else
+		DMAFeed(DMA_t* dma, TIM_TypeDef* timer, const uint16_t permits = 2) : dma(dma), timer(timer), ifcr(getFlagClear(dma)), ifcrMask(getFlagMask(dma)), permits(permits)
+#endif // DMA_CCR_EN
+		{
+
+		}
+
+		~DMAFeed(void)
+		{
+
+		}
+
+
+		/**
+		 * @brief Start timer and DMA feed. IWDG has to be started separately.
+		 * 
+		 * @return \ref Status_t::Done if DMA feed is started.
+		 * @return \ref Status_t::Timeout if DMA stream did not stop within \ref SWDT_TIMEOUT. Timer is not started.
+		 */
+		Status_t start(void)
+		{
+			// Configure DMA for 16-bit memory to peripheral transfers without increment
+#if defined(DMA_CCR_EN)
+			dma->CCR = 0;
+			dma->CPAR = (uint32_t)(uintptr_t)&((IWDG_TypeDef*)(uintptr_t)iwdgBase)->KR;
+			dma->CMAR = (uint32_t)(uintptr_t)&reloadKey;
+			dma->CCR = DMA_CCR_DIR | DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0;
+#else
+			if (disableStream() != Status_t::Done)
+			{
+				return Status_t::Timeout;
+			}
+			dma->PAR = (uint32_t)(uintptr_t)&((IWDG_TypeDef*)(uintptr_t)iwdgBase)->KR;
+			dma->M0AR = (uint32_t)(uintptr_t)&reloadKey;
+#ifdef DMA_SxCR_CHSEL
+			dma->CR = (dma->CR & DMA_SxCR_CHSEL) | DMA_SxCR_DIR_0 | DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0;
+#else
+			dma->CR = DMA_SxCR_DIR_0 | DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0;
+#endif // DMA_SxCR_CHSEL
+#endif // DMA_CCR_EN
+
+			// Arm permits
+			if (feed() != Status_t::Done)
+			{
+				return Status_t::Timeout;
+			}
+
+			// Start timer with update DMA request
+			timer->DIER |= TIM_DIER_UDE;
+			timer->EGR = TIM_EGR_UG;
+			timer->CR1 |= TIM_CR1_CEN;
+			return Status_t::Done;
+		}
+
+		/**
+		 * @brief Re-arm feed permits.
+		 * 
+		 * @return \ref Status_t::Done if permits are re-armed.
+		 * @return \ref Status_t::Timeout if DMA stream did not stop within \ref SWDT_TIMEOUT. Permits are not re-armed, so IWDG resets MCU once remaining permits are used.
+		 */
+		inline Status_t feed(void)
+		{
+#if defined(DMA_CCR_EN)
+			dma->CCR &= ~DMA_CCR_EN;
+			dma->CNDTR = permits;
+			dma->CCR |= DMA_CCR_EN;
+#else
+			if (disableStream() != Status_t::Done)
+			{
+				return Status_t::Timeout;
+			}
+
+			// Stream is not enabled while any of its interrupt flags is set
+			*ifcr = ifcrMask;
+			dma->NDTR = permits;
+			dma->CR |= DMA_SxCR_EN;
+#endif // DMA_CCR_EN
+
+			return Status_t::Done;
+		}
+
+		/**
+		 * @brief Set hardware feed period.
+		 * 
+		 * @param timeout Timer period in ms. Has to be shorter than IWDG timeout.
+		 * @return No return value.
+		 */
+		void setTimeout(uint32_t timeout)
+		{
+			const uint64_t ticks = ((uint64_t)freq * timeout) / 1000;
+			const uint32_t psc = (uint32_t)(ticks >> 16);
+
+			timer->PSC = psc;
+			timer->ARR = (uint32_t)(ticks / (psc + 1)) - 1;
+		}
+
+		void setInputFreq(uint32_t value)
+		{
+			freq = value;
+		}
+
+		/**
+		 * @brief Stop hardware feed.
+		 * 
+		 * @return No return value.
+		 */
+		void stop(void)
+		{
+			timer->CR1 &= ~TIM_CR1_CEN;
+			timer->DIER &= ~TIM_DIER_UDE;
+#if defined(DMA_CCR_EN)
+			dma->CCR &= ~DMA_CCR_EN;
+#else
+			dma->CR &= ~DMA_SxCR_EN;
+#endif // DMA_CCR_EN
+		}
+
+
+		private:
+		// CONSTANTS
+		static constexpr uint16_t reloadKey = 0xAAAA; /**< @brief Reload key for IWDG. DMA source. */
+#if !defined(DMA_CCR_EN)
+		static constexpr uint32_t streamFlags = DMA_LIFCR_CFEIF0 | DMA_LIFCR_CDMEIF0 | DMA_LIFCR_CTEIF0 | DMA_LIFCR_CHTIF0 | DMA_LIFCR_CTCIF0; /**< @brief Interrupt flag clear bits of stream 0. */
+		static constexpr uint8_t streamOffset = 0x10; /**< @brief Offset of stream 0 registers from DMA controller base. */
+		static constexpr uint8_t streamSize = 0x18; /**< @brief Size of stream registers. */
+
+		// METHOD DEFINITIONS
+		/**
+		 * @brief Disable DMA stream and wait until ongoing transfer is finished.
+		 * 
+		 * @return \ref Status_t::Done if stream is disabled.
+		 * @return \ref Status_t::Timeout if stream did not stop within \ref SWDT_TIMEOUT.
+		 */
+		Status_t disableStream(void)
+		{
+			dma->CR &= ~DMA_SxCR_EN;
+
+			// Fast path, stream stops within few bus cycles
+			if (!(dma->CR & DMA_SxCR_EN))
+			{
+				return Status_t::Done;
+			}
+
+			const uint32_t start = SWDT_GET_TICK();
+			while (dma->CR & DMA_SxCR_EN)
+			{
+				if ((SWDT_GET_TICK() - start) >= SWDT_TIMEOUT)
+				{
+					return Status_t::Timeout;
+				}
+			}
+
+			return Status_t::Done;
+		}
+
+		/**
+		 * @brief Get stream index in DMA controller.
+		 * 
+		 * @param dma Pointer to DMA stream.
+		 * @return Stream index from \c 0 to \c 7.
+		 */
+		static inline uint8_t getStream(const DMA_t* dma)
+		{
+			return (uint8_t)((((uintptr_t)dma & 0xFF) - streamOffset) / streamSize);
+		}
+
+		/**
+		 * @brief Get interrupt flag clear register of DMA stream.
+		 * 
+		 * @param dma Pointer to DMA stream.
+		 * @return Pointer to LIFCR for streams 0 to 3 or HIFCR for streams 4 to 7.
+		 */
+		static volatile uint32_t* getFlagClear(const DMA_t* dma)
+		{
+			DMA_TypeDef* ctrl = (DMA_TypeDef*)((uintptr_t)dma & ~(uintptr_t)0xFF);
+
+			return (getStream(dma) < 4) ? &ctrl->LIFCR : &ctrl->HIFCR;
+		}
+
+		/**
+		 * @brief Get interrupt flag clear bits of DMA stream.
+		 * 
+		 * @param dma Pointer to DMA stream.
+		 * @return FEIF, DMEIF, TEIF, HTIF and TCIF clear bits of stream.
+		 */
+		static uint32_t getFlagMask(const DMA_t* dma)
+		{
+			// Flag position of stream inside LIFCR or HIFCR
+			static constexpr uint8_t shift[4] = { 0, 6, 16, 22 };
+
+			return streamFlags << shift[getStream(dma) & 3];
+		}
+#endif // DMA_CCR_EN
+
+		// VARIABLES
+		DMA_t* dma; /**< @brief Pointer to DMA channel or stream. */
+		TIM_TypeDef* timer; /**< @brief Pointer to timer. */
+#if !defined(DMA_CCR_EN)
+		volatile uint32_t* ifcr; /**< @brief Pointer to interrupt flag clear register of DMA stream. */
+		uint32_t ifcrMask; /**< @brief Interrupt flag clear bits of DMA stream. */
+#endif // DMA_CCR_EN
+		uint32_t freq = 16000000; /**< @brief Timer input clock freq. */
+		uint16_t permits; /**< @brief Number of feeds allowed after each re-arm. */
+	};
+#endif // DMA_CCR_EN || DMA_SxCR_EN
+
+#if defined(HSEM) && defined(DUAL_CORE)
+	// CLASS FOR CROSS-CORE HEARTBEAT
+	/**
+	 * @brief Cross-core heartbeat through hardware semaphore.
+	 * 
+	 * Sending core locks and releases semaphore \p S. Release raises HSEM interrupt on receiving core, so receiving core can check in \ref Supervisor channel for other core.
+	 * HSEM clock has to be enabled on both cores.
+	 * 
+	 * @tparam S Hardware semaphore ID.
+	 */
+	template<uint8_t S>
+	class Heartbeat
+	{
+		static_assert(S < 32, "Hardware semaphore ID must be lower than 32");
+
+		public:
+		/**
+		 * @brief Send heartbeat to other core.
+		 * 
+		 * @return \c true if heartbeat is sent.
+		 * @return \c false if semaphore is locked by other core.
+		 */
+		static inline bool beat(void)
+		{
+			// One-step lock returns lock state with core ID
+			const uint32_t lock = HSEM->RLR[S];
+			if ((lock & HSEM_R_LOCK) && ((lock & HSEM_R_COREID_Msk) == coreId))
+			{
+				// Release triggers interrupt on other core
+				HSEM->R[S] = coreId;
+				return true;
+			}
+
+			return false;
+		}
+
+		/**
+		 * @brief Enable heartbeat interrupt on this core.
+		 * 
+		 * @return No return value.
+		 */
+		static void enable(void)
+		{
+			interruptRegs().IER |= mask;
+		}
+
+		/**
+		 * @brief Handle heartbeat interrupt. Call from HSEM interrupt handler on receiving core.
+		 * 
+		 * @return \c true if heartbeat from other core is received.
+		 * @return \c false otherwise.
+		 */
+		static inline bool handleIRQ(void)
+		{
+			if (!(interruptRegs().MISR & mask))
+			{
+				return false;
+			}
+
+			// Clear semaphore interrupt
+			interruptRegs().ICR = mask;
+			return true;
+		}
+
+
+		private:
+		// STRUCTS
+		/**
+		 * @brief HSEM interrupt registers of one core.
+		 * 
+		 */
+		struct IRQRegs_t
+		{
+			volatile uint32_t IER; /**< @brief Interrupt enable register. */
+			volatile uint32_t ICR; /**< @brief Interrupt clear register. */
+			volatile uint32_t ISR; /**< @brief Interrupt status register. */
+			volatile uint32_t MISR; /**< @brief Masked interrupt status register. */
+		};
+
+		// CONSTANTS
+		static constexpr uint32_t mask = (1UL << S); /**< @brief Semaphore mask. */
+#if defined(CORE_CM4)
+		static constexpr uint32_t coreId = (0x01UL << HSEM_R_COREID_Pos); /**< @brief Core ID of CM4. */
+#else
+		static constexpr uint32_t coreId = (0x03UL << HSEM_R_COREID_Pos); /**< @brief Core ID of CM7. */
+#endif // CORE_CM4
+
+		// METHOD DEFINITIONS
+		/**
+		 * @brief Get HSEM interrupt registers for this core.
+		 * 
+		 * @return Reference to interrupt registers.
+		 */
+		static inline IRQRegs_t& interruptRegs(void)
+		{
+#if defined(CORE_CM4)
+			return *(IRQRegs_t*)&HSEM->C2IER;
+#else
+			return *(IRQRegs_t*)&HSEM->C1IER;
+#endif // CORE_CM4
+		}
+	};
+#endif // HSEM && DUAL_CORE
+
+	// CLASS FOR FEED STATISTICS
+	/**
+	 * @brief Feed interval statistics.
+	 * 
+	 * Keeps minimum, maximum and mean feed interval and log2-bucketed histogram of feed intervals measured with \ref Clock.
+	 * 
+	 * @tparam W Watchdog class.
+	 * @tparam E Enable statistics. Disabled statistics only forward calls to watchdog.
+	 * @note \ref Clock::init has to be called before statistics are used.
+	 */
+	template<class W, bool E = SWDT_STATS>
+	class Stats : public SWDT<Stats<W, E>>
+	{
+		static_assert(is_watchdog_v<W>, "Stats requires watchdog driver");
+
+		public:
+		// CONSTANTS
+		static constexpr uint8_t buckets = 32; /**< @brief Number of histogram buckets. Bucket \c n counts intervals from \c 2^n to \c 2^(n+1)-1 \ref Clock units. */
+
+		/**
+		 * @brief Feed statistics constructor.
+		 * 
+		 * @param watchdog Reference to watchdog.
+		 */
+		Stats(W& watchdog) : wdt(watchdog)
+		{
+			reset();
+		}
+
+		~Stats(void)
+		{
+
+		}
+
+
+		void start(void)
+		{
+			wdt.start();
+			lastFeed = Clock::now();
+		}
+
+		/**
+		 * @brief Record feed interval and feed watchdog.
+		 * 
+		 * @return No return value.
+		 */
+		void feed(void)
+		{
+			const uint32_t now = Clock::now();
+			const uint32_t interval = now - lastFeed;
+			lastFeed = now;
+
+			wdt.feed();
+
+			// First feed has no previous reference
+			if (!started)
+			{
+				started = true;
+				return;
+			}
+
+			if (interval < min)
+			{
+				min = interval;
+			}
+
+			if (interval > max)
+			{
+				max = interval;
+			}
+
+			sum += interval;
+			count++;
+			histogram[interval ? (31 - __builtin_clz(interval)) : 0]++;
+		}
+
+		void setTimeout(uint32_t timeout)
+		{
+			wdt.setTimeout(timeout);
+		}
+
+		void setInputFreq(uint32_t value)
+		{
+			wdt.setInputFreq(value);
+		}
+
+		/**
+		 * @brief Reset statistics.
+		 * 
+		 * @return No return value.
+		 */
+		void reset(void)
+		{
+			min = UINT32_MAX;
+			max = 0;
+			sum = 0;
+			count = 0;
+			started = false;
+
+			for (uint8_t i = 0; i < buckets; i++)
+			{
+				histogram[i] = 0;
+			}
+		}
+
+		/**
+		 * @brief Get number of recorded feed intervals.
+		 * 
+		 * @return Number of recorded intervals.
+		 */
+		inline uint32_t getCount(void) const
+		{
+			return count;
+		}
+
+		/**
+		 * @brief Get minimum feed interval.
+		 * 
+		 * @return Minimum interval in \ref Clock units. \c 0 if no interval is recorded.
+		 */
+		inline uint32_t getMin(void) const
+		{
+			return count ? min : 0;
+		}
+
+		/**
+		 * @brief Get maximum feed interval.
+		 * 
+		 * @return Maximum interval in \ref Clock units.
+		 */
+		inline uint32_t getMax(void) const
+		{
+			return max;
+		}
+
+		/**
+		 * @brief Get mean feed interval.
+		 * 
+		 * @return Mean interval in \ref Clock units. \c 0 if no interval is recorded.
+		 */
+		uint32_t getMean(void) const
+		{
+			return count ? (uint32_t)(sum / count) : 0;
+		}
+
+		/**
+		 * @brief Get histogram bucket.
+		 * 
+		 * @param bucket Bucket index. Must be lower than \ref buckets.
+		 * @return Number of intervals in bucket.
+		 */
+		inline uint32_t getBucket(const uint8_t bucket) const
+		{
+			return histogram[bucket];
+		}
+
+		/**
+		 * @brief Get maximum feed interval relative to programmed watchdog timeout.
+		 * 
+		 * @return Maximum interval in percents of timeout returned by watchdog \c getTimeout method.
+		 */
+		uint32_t getMaxPercent(void) const
+		{
+			const uint32_t timeout = wdt.getTimeout();
+			if (!timeout)
+			{
+				return 0;
+			}
+
+			return (uint32_t)(((uint64_t)max * 100000) / ((uint64_t)Clock::getFreq() * timeout));
+		}
+
+
+		private:
+		// VARIABLES
+		W& wdt; /**< @brief Reference to watchdog. */
+		uint32_t lastFeed = 0; /**< @brief Timestamp of last feed. */
+		uint32_t min; /**< @brief Minimum feed interval. */
+		uint32_t max; /**< @brief Maximum feed interval. */
+		uint64_t sum; /**< @brief Sum of all feed intervals. */
+		uint32_t count; /**< @brief Number of recorded feed intervals. */
+		uint32_t histogram[buckets]; /**< @brief Log2-bucketed feed interval histogram. */
+		bool started; /**< @brief First feed is recorded. */
+	};
+
+	/**
+	 * @brief Disabled feed interval statistics. Calls are forwarded to watchdog and statistics are always zero.
+	 * 
+	 * @tparam W Watchdog class.
+	 */
+	template<class W>
+	class Stats<W, false> : public SWDT<Stats<W, false>>
+	{
+		static_assert(is_watchdog_v<W>, "Stats requires watchdog driver");
+
+		public:
+		// CONSTANTS
+		static constexpr uint8_t buckets = 32; /**< @brief Number of histogram buckets. */
+
+		Stats(W& watchdog) : wdt(watchdog)
+		{
+
+		}
+
+		~Stats(void)
+		{
+
+		}
+
+
+		inline void start(void)
+		{
+			wdt.start();
+		}
+
+		inline void feed(void)
+		{
+			wdt.feed();
+		}
+
+		inline void setTimeout(uint32_t timeout)
+		{
+			wdt.setTimeout(timeout);
+		}
+
+		inline void setInputFreq(uint32_t value)
+		{
+			wdt.setInputFreq(value);
+		}
+
+		inline void reset(void)
+		{
+
+		}
+
+		inline uint32_t getCount(void) const
+		{
+			return 0;
+		}
+
+		inline uint32_t getMin(void) const
+		{
+			return 0;
+		}
+
+		inline uint32_t getMax(void) const
+		{
+			return 0;
+		}
+
+		inline uint32_t getMean(void) const
+		{
+			return 0;
+		}
+
+		inline uint32_t getBucket(const uint8_t bucket) const
+		{
+			(void)bucket;
+			return 0;
+		}
+
+		inline uint32_t getMaxPercent(void) const
+		{
+			return 0;
+		}
 
-		}		
 
 		private:
+		// VARIABLES
+		W& wdt; /**< @brief Reference to watchdog. */
 	};
 };
 
@@ -0,0 +1,309 @@
+/**
+ * @file main.cpp
+ * @author silvio3105 (www.github.com/silvio3105)
+ * @brief SWDT target benchmark.
+ * 
+ * Measures CPU cycles per driver call on STM32 target and prints markdown table over SWO/ITM.
+ * Cycles are counted with DWT cycle counter, or with SysTick on Cortex-M0/M0+ cores without DWT. Call cycles are corrected for measurement overhead.
+ * Build with device startup and system files, for example:
+ * F0: arm-none-eabi-g++ -std=c++17 -O2 -mcpu=cortex-m0 -mthumb -DSTM32F030x8 -DMCU_FILE='"stm32f0xx.h"'
+ * F4: arm-none-eabi-g++ -std=c++17 -O2 -mcpu=cortex-m4 -mthumb -DSTM32F411xE -DMCU_FILE='"stm32f4xx.h"'
+ * L4: arm-none-eabi-g++ -std=c++17 -O2 -mcpu=cortex-m4 -mthumb -DSTM32L476xx -DMCU_FILE='"stm32l4xx.h"'
+ * H7: arm-none-eabi-g++ -std=c++17 -O2 -mcpu=cortex-m7 -mthumb -DSTM32H743xx -DCORE_CM7 -DMCU_FILE='"stm32h7xx.h"'
+ * with -I../.. -I<CMSIS include paths> main.cpp startup_<device>.s system_<family>.c
+ * 
+ * Cortex-M0/M0+ cores have no ITM, override \ref benchPutChar to print over UART.
+ * WWDG is not benchmarked, because it cannot be stopped once started.
+ * 
+ * @copyright Copyright (c) 2023, silvio3105
+ * 
+ */
+
+// ----- INCLUDE FILES
+#include			MCU_FILE
+#include			<stdint.h>
+
+// SWDT driver timeouts use benchmark millisecond tick
+extern "C" uint32_t benchTick(void);
+#define SWDT_GET_TICK()				benchTick()
+
+#include			"SWDT.hpp"
+
+
+// ----- DEFINES
+// Cycle counter source
+#ifdef DWT_CTRL_CYCCNTENA_Msk
+#define BENCH_CYCLES()				(DWT->CYCCNT) /**< @brief Current cycle count. Counts up. */
+#else
+#define BENCH_CYCLES()				(0x00FFFFFFUL - SysTick->VAL) /**< @brief Current cycle count from 24-bit SysTick. Counts up. */
+#endif // DWT_CTRL_CYCCNTENA_Msk
+
+#define BENCH_LOOPS					64 /**< @brief Number of measured calls per operation. */
+#define BENCH_SLOW_LOOPS			8 /**< @brief Number of measured calls for operations that wait for IWDG register update. */
+
+
+// ----- FUNCTION DECLARATIONS
+/**
+ * @brief Print one character. Weak, override it to print over UART.
+ * 
+ * @param c Character.
+ * @return No return value.
+ */
+extern "C" void benchPutChar(const char c);
+
+
+// ----- VARIABLES
+static SWDT::IWDGDriver iwdg;
+static SWDT::Supervisor<SWDT::IWDGDriver, 8> supervisor(iwdg);
+static SWDT::DeadlineSupervisor<SWDT::IWDGDriver, 100, 1000> deadlines(iwdg);
+static uint32_t overhead = 0;
+#ifndef DWT_CTRL_CYCCNTENA_Msk
+static volatile uint32_t wraps = 0;
+#endif // DWT_CTRL_CYCCNTENA_Msk
+
+
+// ----- STATIC FUNCTION DECLARATIONS
+/**
+ * @brief Enable cycle counter.
+ * 
+ * @return No return value.
+ */
+static void initCycles(void);
+
+/**
+ * @brief Measure operation cycles.
+ * 
+ * @tparam F Operation type.
+ * @param name Operation name.
+ * @param loops Number of calls.
+ * @param op Operation.
+ * @return No return value.
+ */
+template<class F>
+static void measure(const char* name, const uint16_t loops, F op);
+
+/**
+ * @brief Get cycles of one call.
+ * 
+ * @tparam F Operation type.
+ * @param op Operation.
+ * @return Number of cycles, including measurement overhead.
+ */
+template<class F>
+static inline uint32_t cycles(F op);
+
+/**
+ * @brief Print string.
+ * 
+ * @param str String.
+ * @param width Minimum width. String is padded with spaces on right side.
+ * @return No return value.
+ */
+static void printStr(const char* str, const uint8_t width = 0);
+
+/**
+ * @brief Print unsigned number.
+ * 
+ * @param value Number.
+ * @param width Minimum width. Number is padded with spaces on left side.
+ * @return No return value.
+ */
+static void printNum(uint32_t value, const uint8_t width = 0);
+
+
+// ----- FUNCTION DEFINITIONS
+int main(void)
+{
+	SystemCoreClockUpdate();
+	initCycles();
+	SWDT::Clock::init();
+
+	// Calibrate measurement overhead with empty operation
+	overhead = 0xFFFFFFFF;
+	for (uint8_t i = 0; i < BENCH_LOOPS; i++)
+	{
+		const uint32_t value = cycles([] {});
+		if (value < overhead)
+		{
+			overhead = value;
+		}
+	}
+
+	printStr("SWDT ");
+	printStr(SWDT_VERSION);
+	printStr(" target benchmark, Cortex-M");
+	printNum(__CORTEX_M);
+	printStr(" @ ");
+	printNum(SystemCoreClock);
+	printStr(" Hz\n\n");
+	printStr("| ");
+	printStr("Operation", 36);
+	printStr(" | min cycles | avg cycles |\n");
+	printStr("| ------------------------------------ | ---------- | ---------- |\n");
+
+	// IWDG runs from here on, every operation keeps it fed
+	measure("IWDG::start()", BENCH_LOOPS, [] { iwdg.start(); });
+	measure("IWDG::feed()", BENCH_LOOPS, [] { iwdg.feed(); });
+	measure("IWDG::configure<1000>()", BENCH_SLOW_LOOPS, [] { iwdg.configure<1000>(); });
+	// Feed-only boot path needs hardware watchdog option bit, otherwise boot starts deferred configuration
+	measure(SWDT::IWDGDriver::isHardwareStarted() ? "IWDG::boot<1000>() hw start" : "IWDG::boot<1000>() deferred", BENCH_LOOPS, [] { iwdg.boot<1000>(); });
+	while (iwdg.poll() == SWDT::Status_t::Busy);
+	measure("IWDG::setTimeout(1000)", BENCH_SLOW_LOOPS, [] { iwdg.setTimeout(1000); });
+
+	iwdg.setLazyFeed(50);
+	measure("IWDG::feedLazy()", BENCH_LOOPS, [] { iwdg.feedLazy(); });
+
+	supervisor.registerChannel(0);
+	measure("Supervisor::checkIn()", BENCH_LOOPS, [] { supervisor.checkIn(0); });
+	measure("Supervisor::feed()", BENCH_LOOPS, [] { supervisor.checkIn(0); supervisor.feed(); });
+
+	deadlines.start();
+	measure("DeadlineSupervisor::checkIn()", BENCH_LOOPS, [] { deadlines.checkIn(0); });
+	measure("DeadlineSupervisor::feed() 2ch", BENCH_LOOPS, [] { deadlines.checkIn(0); deadlines.checkIn(1); deadlines.feed(); });
+
+	printStr("\nDone\n");
+
+	for (;;)
+	{
+		iwdg.feed();
+	}
+}
+
+/**
+ * @brief Get millisecond tick.
+ * 
+ * @return Milliseconds since cycle counter start.
+ */
+uint32_t benchTick(void)
+{
+#ifdef DWT_CTRL_CYCCNTENA_Msk
+	return DWT->CYCCNT / (SystemCoreClock / 1000);
+#else
+	// Read wraps and counter consistently
+	uint32_t count;
+	uint32_t wrapCount;
+	do
+	{
+		wrapCount = wraps;
+		count = BENCH_CYCLES();
+	}
+	while (wrapCount != wraps);
+
+	return (uint32_t)((((uint64_t)wrapCount << 24) | count) / (SystemCoreClock / 1000));
+#endif // DWT_CTRL_CYCCNTENA_Msk
+}
+
+__attribute__((weak)) void benchPutChar(const char c)
+{
+#ifdef ITM
+	ITM_SendChar(c);
+#else
+	(void)c;
+#endif // ITM
+}
+
+#ifndef DWT_CTRL_CYCCNTENA_Msk
+extern "C" void SysTick_Handler(void)
+{
+	wraps = wraps + 1;
+}
+#endif // DWT_CTRL_CYCCNTENA_Msk
+
+
+// ----- STATIC FUNCTION DEFINITIONS
+static void initCycles(void)
+{
+#ifndef DWT_CTRL_CYCCNTENA_Msk
+	// Free-running 24-bit SysTick at core clock, wrap interrupt extends it for millisecond tick
+	SysTick->LOAD = 0x00FFFFFFUL;
+	SysTick->VAL = 0;
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+#endif // DWT_CTRL_CYCCNTENA_Msk
+}
+
+template<class F>
+static void measure(const char* name, const uint16_t loops, F op)
+{
+	uint32_t min = 0xFFFFFFFF;
+	uint32_t sum = 0;
+
+	for (uint16_t i = 0; i < loops; i++)
+	{
+		uint32_t value = cycles(op);
+		value = (value > overhead) ? (value - overhead) : 0;
+
+		if (value < min)
+		{
+			min = value;
+		}
+		sum += value;
+	}
+
+	printStr("| ");
+	printStr(name, 36);
+	printStr(" | ");
+	printNum(min, 10);
+	printStr(" | ");
+	printNum(sum / loops, 10);
+	printStr(" |\n");
+}
+
+template<class F>
+static inline uint32_t cycles(F op)
+{
+	const uint32_t start = BENCH_CYCLES();
+	__asm__ volatile("" ::: "memory");
+	op();
+
+	// Keep compiler from moving operation out of measured interval
+	__asm__ volatile("" ::: "memory");
+	const uint32_t end = BENCH_CYCLES();
+
+#ifdef DWT_CTRL_CYCCNTENA_Msk
+	return end - start;
+#else
+	// SysTick is 24-bit
+	return (end - start) & 0x00FFFFFFUL;
+#endif // DWT_CTRL_CYCCNTENA_Msk
+}
+
+static void printStr(const char* str, const uint8_t width)
+{
+	uint8_t len = 0;
+
+	while (*str)
+	{
+		benchPutChar(*str++);
+		len++;
+	}
+
+	while (len++ < width)
+	{
+		benchPutChar(' ');
+	}
+}
+
+static void printNum(uint32_t value, const uint8_t width)
+{
+	char buffer[10];
+	uint8_t len = 0;
+
+	do
+	{
+		buffer[len++] = '0' + (value % 10);
+		value /= 10;
+	}
+	while (value);
+
+	for (uint8_t i = len; i < width; i++)
+	{
+		benchPutChar(' ');
+	}
+
+	while (len)
+	{
+		benchPutChar(buffer[--len]);
+	}
+}
+
+// END WITH NEW LINE
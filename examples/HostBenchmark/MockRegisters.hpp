@@ -0,0 +1,218 @@
+/**
+ * @file MockRegisters.hpp
+ * @author silvio3105 (www.github.com/silvio3105)
+ * @brief Host mock register access policies for SWDT.
+ * 
+ * Mocks record every register access and simulate IWDG register update latency and IWDG refresh window.
+ * 
+ * @copyright Copyright (c) 2023, silvio3105
+ * 
+ */
+
+#ifndef _MOCK_REGISTERS_H_
+#define _MOCK_REGISTERS_H_
+
+// ----- INCLUDE FILES
+#include			"SWDT.hpp"
+#include			<stdint.h>
+
+
+// ----- NAMESPACES
+namespace Mock
+{
+	// STRUCTS
+	/**
+	 * @brief Register access counters.
+	 * 
+	 */
+	struct Stats_t
+	{
+		uint32_t reads = 0; /**< @brief Number of register reads. */
+		uint32_t writes = 0; /**< @brief Number of register writes. */
+		uint32_t feeds = 0; /**< @brief Number of reload key writes. */
+		uint32_t unlocks = 0; /**< @brief Number of access key writes. */
+		uint32_t ignored = 0; /**< @brief Number of register writes ignored by simulated hardware. */
+		uint32_t resets = 0; /**< @brief Number of refreshes before window opened. Each one resets MCU on hardware. */
+	};
+
+	// CLASS FOR MOCK IWDG
+	/**
+	 * @brief Mock IWDG register access policy.
+	 * 
+	 * PR, RLR and WINR writes are accepted only after access key and set PVU, RVU or WVU flag for \ref latency status register reads.
+	 * Counter runs from 32 kHz input clock in \c SWDT_GET_TICK time. WINR write reloads counter and reload key written while counter is above WINR is counted as reset.
+	 */
+	struct IWDG
+	{
+		static inline uint32_t regs[5] = { 0, 0, 0x0FFF, 0, 0x0FFF }; /**< @brief Simulated KR, PR, RLR, SR and WINR registers. */
+		static inline uint8_t countdown[3] = { 0, 0, 0 }; /**< @brief Remaining SR reads until PVU, RVU and WVU clear. */
+		static inline uint8_t latency = 5; /**< @brief Register update latency in SR reads. */
+		static inline bool unlocked = false; /**< @brief Register write access state. */
+		static inline bool running = false; /**< @brief Watchdog start state. */
+		static inline uint32_t reloadTick = 0; /**< @brief Tick of last counter reload. */
+		static inline Stats_t stats; /**< @brief Access counters. */
+
+		static void reset(void)
+		{
+			regs[0] = 0;
+			regs[1] = 0;
+			regs[2] = 0x0FFF;
+			regs[3] = 0;
+			regs[4] = 0x0FFF;
+			countdown[0] = 0;
+			countdown[1] = 0;
+			countdown[2] = 0;
+			unlocked = false;
+			running = false;
+			reloadTick = SWDT_GET_TICK();
+			stats = Stats_t();
+		}
+
+		static uint32_t read(const SWDT::IWDGReg_t reg)
+		{
+			stats.reads++;
+
+			if (reg == SWDT::IWDGReg_t::SR)
+			{
+				// Advance register update simulation
+				for (uint8_t i = 0; i < 3; i++)
+				{
+					if (countdown[i] && !--countdown[i])
+					{
+						regs[3] &= ~(1UL << i);
+					}
+				}
+			}
+
+			return regs[(uint8_t)reg];
+		}
+
+		static void write(const SWDT::IWDGReg_t reg, const uint32_t value)
+		{
+			stats.writes++;
+
+			switch (reg)
+			{
+				case SWDT::IWDGReg_t::KR:
+				{
+					if (value == 0x5555)
+					{
+						unlocked = true;
+						stats.unlocks++;
+					}
+					else
+					{
+						// Reload and start keys enable register protection
+						unlocked = false;
+						if (value == 0xAAAA)
+						{
+							stats.feeds++;
+
+							// Refresh above window value resets MCU
+							if (running && counter() > regs[4])
+							{
+								stats.resets++;
+							}
+							reloadTick = SWDT_GET_TICK();
+						}
+						else if (value == 0xCCCC)
+						{
+							running = true;
+							reloadTick = SWDT_GET_TICK();
+						}
+					}
+					break;
+				}
+
+				case SWDT::IWDGReg_t::PR:
+				case SWDT::IWDGReg_t::RLR:
+				case SWDT::IWDGReg_t::WINR:
+				{
+					// Update flag index matches SR bit position
+					const uint8_t idx = (reg == SWDT::IWDGReg_t::PR) ? 0 : ((reg == SWDT::IWDGReg_t::RLR) ? 1 : 2);
+
+					// Write is ignored when protected or while previous update is ongoing
+					if (!unlocked || (regs[3] & (1UL << idx)))
+					{
+						stats.ignored++;
+						break;
+					}
+
+					regs[(uint8_t)reg] = value;
+					regs[3] |= (1UL << idx);
+					countdown[idx] = latency;
+
+					// Window write reloads counter
+					if (reg == SWDT::IWDGReg_t::WINR)
+					{
+						reloadTick = SWDT_GET_TICK();
+					}
+					break;
+				}
+
+				default:
+				{
+					break;
+				}
+			}
+		}
+
+		/**
+		 * @brief Get simulated counter value.
+		 * 
+		 * @return Counter value. \c 0 if counter expired.
+		 */
+		static uint32_t counter(void)
+		{
+			// 32 input clock ticks per ms divided by PR prescaler
+			const uint32_t elapsed = ((SWDT_GET_TICK() - reloadTick) * 32UL) >> (regs[1] + 2);
+
+			return (elapsed < regs[2]) ? (regs[2] - elapsed) : 0;
+		}
+	};
+
+	// CLASS FOR MOCK WWDG
+	/**
+	 * @brief Mock WWDG register access policy.
+	 * 
+	 */
+	struct WWDG
+	{
+		static inline uint32_t regs[3] = { 0x7F, 0x7F, 0 }; /**< @brief Simulated CR, CFR and SR registers. */
+		static inline Stats_t stats; /**< @brief Access counters. */
+
+		static void reset(void)
+		{
+			regs[0] = 0x7F;
+			regs[1] = 0x7F;
+			regs[2] = 0;
+			stats = Stats_t();
+		}
+
+		static uint32_t read(const SWDT::WWDGReg_t reg)
+		{
+			stats.reads++;
+			return regs[(uint8_t)reg];
+		}
+
+		static void write(const SWDT::WWDGReg_t reg, const uint32_t value)
+		{
+			stats.writes++;
+
+			if (reg == SWDT::WWDGReg_t::CR)
+			{
+				// WDGA bit can only be set
+				regs[0] = (regs[0] & WWDG_CR_WDGA) | value;
+				stats.feeds++;
+			}
+			else
+			{
+				regs[(uint8_t)reg] = value;
+			}
+		}
+	};
+};
+
+#endif // _MOCK_REGISTERS_H_
+
+// END WITH NEW LINE
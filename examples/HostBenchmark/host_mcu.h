@@ -0,0 +1,229 @@
+/**
+ * @file host_mcu.h
+ * @author silvio3105 (www.github.com/silvio3105)
+ * @brief Minimal CMSIS stand-in for building SWDT on host.
+ * 
+ * Provides only register layouts, bit definitions and core functions used by SWDT. Registers are never accessed through base addresses on host, register access goes through mock policies from \ref MockRegisters.hpp.
+ * LPTIM, DMA stream, DBGMCU and HSEM definitions follow STM32F4, STM32L4 and STM32H7 layouts, so \c PreTimeout, \c DMAFeed, \c Debug and \c Heartbeat compile in \ref size.cpp. They are not simulated.
+ * 
+ * @copyright Copyright (c) 2023, silvio3105
+ * 
+ */
+
+#ifndef _HOST_MCU_H_
+#define _HOST_MCU_H_
+
+// ----- INCLUDE FILES
+#include			<stdint.h>
+
+
+// ----- DEFINES
+#define __IO						volatile
+
+#define __CORTEX_M					0 /**< @brief Host behaves like Cortex-M0 without exclusive access instructions. */
+
+#define IWDG_BASE					0x40003000UL
+#define WWDG_BASE					0x40002C00UL
+#define RCC							((RCC_TypeDef*)0x40021000UL)
+#define TIM2						((TIM_TypeDef*)0x40000000UL)
+#define LPTIM1						((LPTIM_TypeDef*)0x40007C00UL)
+#define DMA1_Stream1				((DMA_Stream_TypeDef*)0x40026028UL)
+#define DBGMCU						((DBGMCU_TypeDef*)0xE0042000UL)
+#define HSEM						((HSEM_TypeDef*)0x58026400UL)
+
+#define DUAL_CORE					/**< @brief Enables cross-core heartbeat. */
+#define FLASH						(&hostFlash) /**< @brief Host option bytes. Zero value selects hardware watchdog. */
+
+#define IWDG_SR_PVU					(1UL << 0)
+#define IWDG_SR_RVU					(1UL << 1)
+#define IWDG_SR_WVU					(1UL << 2)
+#define IWDG_WINR_WIN				(0xFFFUL << 0)
+
+#define WWDG_CR_WDGA				(1UL << 7)
+#define WWDG_CFR_WDGTB_Pos			7
+#define WWDG_CFR_WDGTB_Msk			(3UL << WWDG_CFR_WDGTB_Pos)
+#define WWDG_CFR_EWI				(1UL << 9)
+
+#define TIM_CR1_CEN					(1UL << 0)
+#define TIM_DIER_UDE				(1UL << 8)
+#define TIM_EGR_UG					(1UL << 0)
+#define TIM_SR_CC1IF				(1UL << 1)
+#define TIM_CCMR1_CC1S_0			(1UL << 0)
+#define TIM_CCMR1_IC1PSC			(3UL << 2)
+#define TIM_CCER_CC1E				(1UL << 0)
+
+#define LPTIM_ISR_ARROK				(1UL << 4)
+#define LPTIM_ICR_ARRMCF			(1UL << 1)
+#define LPTIM_ICR_ARROKCF			(1UL << 4)
+#define LPTIM_IER_ARRMIE			(1UL << 1)
+#define LPTIM_CFGR_PRESC_Pos		9
+#define LPTIM_CR_ENABLE				(1UL << 0)
+#define LPTIM_CR_CNTSTRT			(1UL << 2)
+
+#define DMA_SxCR_EN					(1UL << 0)
+#define DMA_SxCR_DIR_0				(1UL << 6)
+#define DMA_SxCR_PSIZE_0			(1UL << 11)
+#define DMA_SxCR_MSIZE_0			(1UL << 13)
+#define DMA_SxCR_CHSEL				(7UL << 25)
+#define DMA_LIFCR_CFEIF0			(1UL << 0)
+#define DMA_LIFCR_CDMEIF0			(1UL << 2)
+#define DMA_LIFCR_CTEIF0			(1UL << 3)
+#define DMA_LIFCR_CHTIF0			(1UL << 4)
+#define DMA_LIFCR_CTCIF0			(1UL << 5)
+
+#define DBGMCU_APB1_FZ_DBG_WWDG_STOP	(1UL << 11)
+#define DBGMCU_APB1_FZ_DBG_IWDG_STOP	(1UL << 12)
+
+#define HSEM_R_COREID_Pos			8
+#define HSEM_R_COREID_Msk			(0xFUL << HSEM_R_COREID_Pos)
+#define HSEM_R_LOCK					(1UL << 31)
+
+#define FLASH_OPTR_IWDG_SW			(1UL << 16)
+
+#define RCC_CSR_RMVF				(1UL << 24)
+#define RCC_CSR_IWDGRSTF			(1UL << 29)
+#define RCC_CSR_WWDGRSTF			(1UL << 30)
+
+#define SWDT_GET_TICK()				hostTick() /**< @brief Host millisecond tick. */
+
+
+// ----- TYPEDEFS
+typedef struct
+{
+	__IO uint32_t KR;
+	__IO uint32_t PR;
+	__IO uint32_t RLR;
+	__IO uint32_t SR;
+	__IO uint32_t WINR;
+} IWDG_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t CR;
+	__IO uint32_t CFR;
+	__IO uint32_t SR;
+} WWDG_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t CR1;
+	__IO uint32_t CR2;
+	__IO uint32_t SMCR;
+	__IO uint32_t DIER;
+	__IO uint32_t SR;
+	__IO uint32_t EGR;
+	__IO uint32_t CCMR1;
+	__IO uint32_t CCMR2;
+	__IO uint32_t CCER;
+	__IO uint32_t CNT;
+	__IO uint32_t PSC;
+	__IO uint32_t ARR;
+	__IO uint32_t RCR;
+	__IO uint32_t CCR1;
+} TIM_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t ISR;
+	__IO uint32_t ICR;
+	__IO uint32_t IER;
+	__IO uint32_t CFGR;
+	__IO uint32_t CR;
+	__IO uint32_t CMP;
+	__IO uint32_t ARR;
+	__IO uint32_t CNT;
+} LPTIM_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t CR;
+	__IO uint32_t NDTR;
+	__IO uint32_t PAR;
+	__IO uint32_t M0AR;
+	__IO uint32_t M1AR;
+	__IO uint32_t FCR;
+} DMA_Stream_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t LISR;
+	__IO uint32_t HISR;
+	__IO uint32_t LIFCR;
+	__IO uint32_t HIFCR;
+} DMA_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t IDCODE;
+	__IO uint32_t CR;
+	__IO uint32_t APB1FZ;
+	__IO uint32_t APB2FZ;
+} DBGMCU_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t R[32];
+	__IO uint32_t RLR[32];
+	__IO uint32_t C1IER;
+	__IO uint32_t C1ICR;
+	__IO uint32_t C1ISR;
+	__IO uint32_t C1MISR;
+	__IO uint32_t C2IER;
+	__IO uint32_t C2ICR;
+	__IO uint32_t C2ISR;
+	__IO uint32_t C2MISR;
+} HSEM_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t CSR;
+} RCC_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t OPTR;
+} FLASH_TypeDef;
+
+typedef enum
+{
+	WWDG_IRQn = 0,
+	LPTIM1_IRQn = 65
+} IRQn_Type;
+
+
+// ----- FUNCTION DECLARATIONS
+uint32_t hostTick(void);
+
+
+// ----- VARIABLES
+extern FLASH_TypeDef hostFlash;
+
+static inline uint32_t __get_PRIMASK(void)
+{
+	return 0;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+	(void)primask;
+}
+
+static inline void __disable_irq(void)
+{
+
+}
+
+static inline void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)
+{
+	(void)irq;
+	(void)priority;
+}
+
+static inline void NVIC_EnableIRQ(IRQn_Type irq)
+{
+	(void)irq;
+}
+
+#endif // _HOST_MCU_H_
+
+// END WITH NEW LINE
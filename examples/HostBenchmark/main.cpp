@@ -0,0 +1,151 @@
+/**
+ * @file main.cpp
+ * @author silvio3105 (www.github.com/silvio3105)
+ * @brief SWDT host benchmark.
+ * 
+ * Runs SWDT drivers on mock registers and reports time and register accesses per call.
+ * Build on host with:
+ * g++ -std=c++17 -O2 -I. -I../.. -DMCU_FILE='"host_mcu.h"' main.cpp -o HostBenchmark
+ * 
+ * For flash bytes per call on Cortex-M reference, build \ref size.cpp with target compiler and list symbol sizes:
+ * arm-none-eabi-g++ -std=c++17 -Os -mcpu=cortex-m0 -mthumb -I../.. -I<CMSIS include paths> -DMCU_FILE='"stm32f0xx.h"' -DSTM32F030x8 -c size.cpp
+ * arm-none-eabi-nm -S --size-sort size.o
+ * Functions are named \c size_<profile>_<method> and \c size_<module>_<method>, sum sizes of one group and driver methods it calls to get flash per profile or module. Modules missing on target MCU are skipped. Reference numbers in README.md are generic builds with clang against \ref host_mcu.h, second column uses \c thumbv7em-none-eabi and \c -mcpu=cortex-m4:
+ * clang++ --target=thumbv6m-none-eabi -mcpu=cortex-m0 -mfloat-abi=soft -std=c++17 -Os -ffreestanding -ffunction-sections -fdata-sections -I. -I../.. -DMCU_FILE='"host_mcu.h"' -c size.cpp
+ * 
+ * @copyright Copyright (c) 2023, silvio3105
+ * 
+ */
+
+// ----- INCLUDE FILES
+#include			"MockRegisters.hpp"
+#include			<stdio.h>
+#include			<chrono>
+
+
+// ----- TYPEDEFS
+using IWDG = SWDT::BasicIWDG<Mock::IWDG>;
+using WWDG = SWDT::BasicWWDG<Mock::WWDG>;
+
+
+// ----- VARIABLES
+FLASH_TypeDef hostFlash = {};
+static IWDG iwdg;
+static WWDG wwdg;
+static SWDT::Supervisor<IWDG, 12> supervisor(iwdg);
+static SWDT::HeartbeatAggregator<SWDT::Supervisor<IWDG, 12>, 8, 4> heartbeats(supervisor);
+static SWDT::DeadlineSupervisor<IWDG, 5, 20, 100, 2000> deadlines(iwdg);
+static SWDT::HeartbeatAggregator<SWDT::DeadlineSupervisor<IWDG, 5, 20, 100, 2000>, 2, 2> nodeDeadlines(deadlines);
+static SWDT::Stats<IWDG, true> stats(iwdg);
+
+
+// ----- STATIC FUNCTION DECLARATIONS
+/**
+ * @brief Measure operation and print one result row.
+ * 
+ * @tparam F Operation type.
+ * @param name Operation name.
+ * @param stats Reference to mock access counters.
+ * @param loops Number of calls.
+ * @param op Operation.
+ * @return No return value.
+ */
+template<class F>
+static void measure(const char* name, const Mock::Stats_t& stats, const uint32_t loops, F op);
+
+
+// ----- FUNCTION DEFINITIONS
+uint32_t hostTick(void)
+{
+	static const auto start = std::chrono::steady_clock::now();
+	return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(void)
+{
+	printf("SWDT %s host benchmark\n\n", SWDT_VERSION);
+	printf("| %-36s | %10s | %10s | %10s |\n", "Operation", "ns/call", "reads", "writes");
+	printf("| %-36s | %10s | %10s | %10s |\n", "------------------------------------", "----------", "----------", "----------");
+
+	Mock::IWDG::reset();
+	Mock::WWDG::reset();
+	SWDT::Clock::init();
+
+	measure("IWDG::start()", Mock::IWDG::stats, 1000000, [] { iwdg.start(); });
+	measure("IWDG::feed()", Mock::IWDG::stats, 1000000, [] { iwdg.feed(); });
+	measure("IWDG::configure<1000>()", Mock::IWDG::stats, 100000, [] { iwdg.configure<1000>(); });
+	measure("IWDG::boot<1000>() (configured)", Mock::IWDG::stats, 100000, [] { iwdg.boot<1000>(); });
+	measure("IWDG::setTimeout(1000)", Mock::IWDG::stats, 100000, [] { iwdg.setTimeout(1000); });
+	measure("IWDG::beginConfigure()+poll()", Mock::IWDG::stats, 100000, []
+	{
+		iwdg.beginConfigure(IWDG::Prescaler_t::Div32, 999);
+		while (iwdg.poll() == SWDT::Status_t::Busy);
+	});
+
+	measure("IWDG::configure<1000, 32000, 200>()", Mock::IWDG::stats, 100000, [] { iwdg.configure<1000, 32000, 200>(); });
+	measure("IWDG::feedIfAllowed()", Mock::IWDG::stats, 1000000, [] { iwdg.feedIfAllowed(); });
+
+	// Disable window, following rows feed without window check
+	iwdg.configure<1000>();
+
+	iwdg.setLazyFeed(50);
+	measure("IWDG::feedLazy()", Mock::IWDG::stats, 1000000, [] { iwdg.feedLazy(); });
+
+	supervisor.registerChannel(0);
+	measure("Supervisor::checkIn()", Mock::IWDG::stats, 1000000, [] { supervisor.checkIn(0); });
+	measure("Supervisor::feed()", Mock::IWDG::stats, 1000000, [] { supervisor.checkIn(0); supervisor.feed(); });
+
+	static uint8_t seq = 0;
+	measure("HeartbeatAggregator::onHeartbeat()", Mock::IWDG::stats, 1000000, [] { heartbeats.onHeartbeat(3, ++seq); });
+
+	deadlines.start();
+	measure("DeadlineSupervisor::checkIn()", Mock::IWDG::stats, 1000000, [] { deadlines.checkIn(0); });
+	measure("onHeartbeat() per-node deadline", Mock::IWDG::stats, 1000000, [] { nodeDeadlines.onHeartbeat(1, ++seq); });
+	measure("DeadlineSupervisor::feed() 4ch", Mock::IWDG::stats, 1000000, []
+	{
+		for (uint8_t i = 0; i < deadlines.channels; i++)
+		{
+			deadlines.checkIn(i);
+		}
+		deadlines.feed();
+	});
+
+	measure("Stats::feed()", Mock::IWDG::stats, 1000000, [] { stats.feed(); });
+
+	measure("WWDG::start()", Mock::WWDG::stats, 1000000, [] { wwdg.start(); });
+	measure("WWDG::feed()", Mock::WWDG::stats, 1000000, [] { wwdg.feed(); });
+	measure("WWDG::feedIfInWindow()", Mock::WWDG::stats, 1000000, [] { wwdg.feedIfInWindow(); });
+	measure("WWDG::setTimeout(20)", Mock::WWDG::stats, 100000, [] { wwdg.setTimeout(20); });
+
+	// Ignored writes mean driver wrote PR or RLR while register update was ongoing
+	printf("\nIgnored IWDG register writes: %u\n", Mock::IWDG::stats.ignored);
+
+	// Resets mean driver refreshed IWDG before window opened
+	printf("IWDG refreshes before window: %u\n", Mock::IWDG::stats.resets);
+
+	return ((Mock::IWDG::stats.ignored || Mock::IWDG::stats.resets) ? 1 : 0);
+}
+
+
+// ----- STATIC FUNCTION DEFINITIONS
+template<class F>
+static void measure(const char* name, const Mock::Stats_t& stats, const uint32_t loops, F op)
+{
+	const uint32_t reads = stats.reads;
+	const uint32_t writes = stats.writes;
+
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < loops; i++)
+	{
+		op();
+
+		// Keep compiler from merging loop iterations
+		__asm__ volatile("" ::: "memory");
+	}
+	const auto end = std::chrono::steady_clock::now();
+
+	const double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / loops;
+	printf("| %-36s | %10.2f | %10.2f | %10.2f |\n", name, ns, (double)(stats.reads - reads) / loops, (double)(stats.writes - writes) / loops);
+}
+
+// END WITH NEW LINE
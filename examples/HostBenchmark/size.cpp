@@ -0,0 +1,264 @@
+/**
+ * @file size.cpp
+ * @author silvio3105 (www.github.com/silvio3105)
+ * @brief SWDT code size reference.
+ * 
+ * Each function wraps one driver call on memory-mapped registers. Functions are grouped per feature profile with \c size_<profile>_ prefix, each group calls every method its profile adds. Optional modules are grouped with \c size_<module>_ prefix. Build for target and list symbol sizes to get flash bytes per call, per profile and per module, see \ref main.cpp.
+ * 
+ * @copyright Copyright (c) 2023, silvio3105
+ * 
+ */
+
+// ----- INCLUDE FILES
+#include			"SWDT.hpp"
+
+
+// ----- STATIC FUNCTION DECLARATIONS
+/**
+ * @brief Empty pre-timeout hook.
+ * 
+ * @return No return value.
+ */
+static void sizeHook(void);
+
+
+// ----- VARIABLES
+static SWDT::BasicIWDG<SWDT::IWDGMemory<>, SWDT::IWDGTraits, SWDT::Profiles::Minimal> iwdgMinimal;
+static SWDT::BasicIWDG<SWDT::IWDGMemory<>, SWDT::IWDGTraits, SWDT::Profiles::Runtime> iwdgRuntime;
+static SWDT::BasicIWDG<SWDT::IWDGMemory<>, SWDT::IWDGTraits, SWDT::Profiles::Async> iwdgAsync;
+static SWDT::BasicIWDG<SWDT::IWDGMemory<>, SWDT::IWDGTraits, SWDT::Profiles::Full> iwdgFull;
+static SWDT::WWDGDriver wwdg;
+#if defined(LPTIM_CR_ENABLE) && defined(LPTIM_IER_ARRMIE)
+static SWDT::PreTimeout<SWDT::BasicIWDG<SWDT::IWDGMemory<>, SWDT::IWDGTraits, SWDT::Profiles::Runtime>, sizeHook> preTimeout(iwdgRuntime, LPTIM1, 32000);
+#endif // LPTIM_CR_ENABLE && LPTIM_IER_ARRMIE
+#if defined(DMA_SxCR_EN)
+static SWDT::DMAFeed dmaFeed(DMA1_Stream1, TIM2);
+#endif // DMA_SxCR_EN
+
+
+// ----- FUNCTION DEFINITIONS
+// PROFILE MINIMAL
+extern "C" void size_Minimal_start(void)
+{
+	iwdgMinimal.start();
+}
+
+extern "C" void size_Minimal_feed(void)
+{
+	iwdgMinimal.feed();
+}
+
+extern "C" void size_Minimal_configure(void)
+{
+	iwdgMinimal.configure<1000>();
+}
+
+// PROFILE RUNTIME
+extern "C" void size_Runtime_start(void)
+{
+	iwdgRuntime.start();
+}
+
+extern "C" void size_Runtime_feed(void)
+{
+	iwdgRuntime.feed();
+}
+
+extern "C" void size_Runtime_configure(void)
+{
+	iwdgRuntime.configure<1000>();
+}
+
+extern "C" void size_Runtime_setTimeout(uint32_t timeout, SWDT::Timing_t* timing)
+{
+	*timing = iwdgRuntime.setTimeout(timeout);
+}
+
+extern "C" uint32_t size_Runtime_getTimeout(void)
+{
+	return iwdgRuntime.getTimeout();
+}
+
+extern "C" SWDT::Status_t size_Runtime_calibrate(TIM_TypeDef* timer)
+{
+	return iwdgRuntime.calibrate(timer, 1000000);
+}
+
+// PROFILE ASYNC
+extern "C" void size_Async_start(void)
+{
+	iwdgAsync.start();
+}
+
+extern "C" void size_Async_feed(void)
+{
+	iwdgAsync.feed();
+}
+
+extern "C" void size_Async_configure(void)
+{
+	iwdgAsync.configure<1000>();
+}
+
+extern "C" void size_Async_setTimeout(uint32_t timeout, SWDT::Timing_t* timing)
+{
+	*timing = iwdgAsync.setTimeout(timeout);
+}
+
+extern "C" uint32_t size_Async_getTimeout(void)
+{
+	return iwdgAsync.getTimeout();
+}
+
+extern "C" SWDT::Status_t size_Async_calibrate(TIM_TypeDef* timer)
+{
+	return iwdgAsync.calibrate(timer, 1000000);
+}
+
+extern "C" SWDT::Status_t size_Async_beginConfigure(void)
+{
+	return iwdgAsync.beginConfigure<1000>();
+}
+
+extern "C" SWDT::Status_t size_Async_poll(void)
+{
+	return iwdgAsync.poll();
+}
+
+extern "C" SWDT::Status_t size_Async_boot(void)
+{
+	return iwdgAsync.boot<1000>();
+}
+
+// PROFILE FULL
+extern "C" void size_Full_start(void)
+{
+	iwdgFull.start();
+}
+
+extern "C" void size_Full_feed(void)
+{
+	iwdgFull.feed();
+}
+
+extern "C" void size_Full_configure(void)
+{
+	iwdgFull.configure<1000>();
+}
+
+extern "C" void size_Full_setTimeout(uint32_t timeout, SWDT::Timing_t* timing)
+{
+	*timing = iwdgFull.setTimeout(timeout);
+}
+
+extern "C" uint32_t size_Full_getTimeout(void)
+{
+	return iwdgFull.getTimeout();
+}
+
+extern "C" SWDT::Status_t size_Full_calibrate(TIM_TypeDef* timer)
+{
+	return iwdgFull.calibrate(timer, 1000000);
+}
+
+extern "C" SWDT::Status_t size_Full_beginConfigure(void)
+{
+	return iwdgFull.beginConfigure<1000>();
+}
+
+extern "C" SWDT::Status_t size_Full_poll(void)
+{
+	return iwdgFull.poll();
+}
+
+extern "C" SWDT::Status_t size_Full_boot(void)
+{
+	return iwdgFull.boot<1000>();
+}
+
+extern "C" void size_Full_feedLazy(void)
+{
+	iwdgFull.feedLazy();
+}
+
+extern "C" bool size_Full_feedIfAllowed(void)
+{
+	return iwdgFull.feedIfAllowed();
+}
+
+// WWDG
+extern "C" void size_WWDG_feed(void)
+{
+	wwdg.feed();
+}
+
+extern "C" bool size_WWDG_feedIfInWindow(void)
+{
+	return wwdg.feedIfInWindow();
+}
+
+#if defined(LPTIM_CR_ENABLE) && defined(LPTIM_IER_ARRMIE)
+// PRE-TIMEOUT
+extern "C" void size_PreTimeout_feed(void)
+{
+	preTimeout.feed();
+}
+
+extern "C" SWDT::Status_t size_PreTimeout_setTimeout(uint32_t timeout)
+{
+	return preTimeout.setTimeout(timeout);
+}
+
+extern "C" void size_PreTimeout_handleIRQ(void)
+{
+	preTimeout.handleIRQ();
+}
+#endif // LPTIM_CR_ENABLE && LPTIM_IER_ARRMIE
+
+#if defined(DMA_SxCR_EN)
+// DMA FEED
+extern "C" SWDT::Status_t size_DMAFeed_start(void)
+{
+	return dmaFeed.start();
+}
+
+extern "C" SWDT::Status_t size_DMAFeed_feed(void)
+{
+	return dmaFeed.feed();
+}
+#endif // DMA_SxCR_EN
+
+#if defined(DBGMCU) && (defined(DBGMCU_APB1_FZ_DBG_IWDG_STOP) || defined(DBGMCU_CR_DBG_IWDG_STOP) || defined(DBGMCU_APB1FZR1_DBG_IWDG_STOP) || defined(DBGMCU_APB_FZ1_DBG_IWDG_STOP) || defined(DBGMCU_APB4FZ1_DBG_IWDG1))
+// DEBUG
+extern "C" bool size_Debug_init(void)
+{
+	return SWDT::Debug::init();
+}
+
+extern "C" void size_Debug_freeze(bool enable)
+{
+	SWDT::Debug::freeze(enable);
+}
+#endif // DBGMCU && DBGMCU_APB1_FZ_DBG_IWDG_STOP
+
+#if defined(HSEM) && defined(DUAL_CORE)
+// HEARTBEAT
+extern "C" bool size_Heartbeat_beat(void)
+{
+	return SWDT::Heartbeat<0>::beat();
+}
+
+extern "C" bool size_Heartbeat_handleIRQ(void)
+{
+	return SWDT::Heartbeat<0>::handleIRQ();
+}
+#endif // HSEM && DUAL_CORE
+
+
+// ----- STATIC FUNCTION DEFINITIONS
+static void sizeHook(void)
+{
+
+}
+
+// END WITH NEW LINE